@@ -147,6 +147,91 @@ namespace picongpu
             return result_y;
         }
 
+        /** Does a 3D trilinear field-to-point interpolation with precomputed weights
+         *
+         * The result is equal to interpolate() if weights[d][i] is the assignment
+         * function evaluated for grid point T_begin + i along dimension d.
+         *
+         * \tparam T_begin lower margin for interpolation
+         * \tparam T_end upper margin for interpolation
+         *
+         * \param cursor cursor pointing to the field
+         * \param weights per dimension weights of the grid points in range [T_begin;T_end]
+         * \return sum over: field_value * assignment
+         */
+        template<
+            int T_begin,
+            int T_end,
+            typename T_Cursor
+        >
+        HDINLINE static
+        auto
+        interpolateWithWeights(
+            T_Cursor const & cursor,
+            float_X const * const ( & weights )[ 3 ]
+        )
+        -> typename ::pmacc::result_of::Functor<
+            AssignedTrilinearInterpolation,
+            T_Cursor
+        >::type
+        {
+            using type = typename ::pmacc::result_of::Functor<
+                AssignedTrilinearInterpolation,
+                T_Cursor
+            >::type;
+
+            type result_z = type( 0.0 );
+            for( int z = T_begin; z <= T_end; ++z )
+            {
+                type result_y = type( 0.0 );
+                for( int y = T_begin; y <= T_end; ++y )
+                {
+                    type result_x = type( 0.0 );
+                    for( int x = T_begin; x <= T_end; ++x )
+                        result_x += *cursor( x, y, z ) * weights[ 0 ][ x - T_begin ];
+
+                    result_y += result_x * weights[ 1 ][ y - T_begin ];
+                }
+
+                result_z += result_y * weights[ 2 ][ z - T_begin ];
+            }
+            return result_z;
+        }
+
+        /** Implementation for 2D with precomputed weights*/
+        template<
+            int T_begin,
+            int T_end,
+            class T_Cursor
+        >
+        HDINLINE static
+        auto
+        interpolateWithWeights(
+            T_Cursor const & cursor,
+            float_X const * const ( & weights )[ 2 ]
+        )
+        -> typename ::pmacc::result_of::Functor<
+            AssignedTrilinearInterpolation,
+            T_Cursor
+        >::type
+        {
+            using type = typename ::pmacc::result_of::Functor<
+                AssignedTrilinearInterpolation,
+                T_Cursor
+            >::type;
+
+            type result_y = type( 0.0 );
+            for( int y = T_begin; y <= T_end; ++y )
+            {
+                type result_x = type( 0.0 );
+                for( int x = T_begin; x <= T_end; ++x )
+                    result_x += *cursor( x, y ) * weights[ 0 ][ x - T_begin ];
+
+                result_y += result_x * weights[ 1 ][ y - T_begin ];
+            }
+            return result_y;
+        }
+
         static
         auto
         getStringProperties()
@@ -35,6 +35,12 @@ namespace picongpu
  * interpolate around a point from -AssignmentFunction::support/2 to
  * (AssignmentFunction::support+1)/2
  *
+ * The 1D assignment weights of the particle are evaluated once per axis and
+ * distinct field position and shared between all field components.
+ * On the Yee grid each axis has only two distinct field positions (0 and 0.5),
+ * therefore one object can interpolate all components of E and B with the
+ * same weights as long as the particle position does not change.
+ *
  * \tparam GridShiftMethod functor which shift coordinate system that al value are
  * located on corner
  * \tparam AssignmentFunction AssignmentFunction which is used for interpolation
@@ -71,18 +77,30 @@ struct FieldToParticleInterpolation
     static constexpr int begin = -supp / 2 + (supp + 1) % 2;
     static constexpr int end = begin+supp-1;
 
+    HDINLINE FieldToParticleInterpolation() :
+        m_particlePos( floatD_X::create( 0.0 ) )
+    {
+        for( uint32_t d = 0; d < simDim; ++d )
+            m_numWeights[ d ] = 0u;
+    }
 
     template<class Cursor, class VecVector>
     HDINLINE typename Cursor::ValueType operator()(Cursor field,
                                                    const floatD_X& particlePos,
                                                    const VecVector& fieldPos)
     {
+        /* weights of an old particle position are invalid */
+        if( particlePos != m_particlePos )
+        {
+            m_particlePos = particlePos;
+            for( uint32_t d = 0; d < simDim; ++d )
+                m_numWeights[ d ] = 0u;
+        }
+
         /**\brief:
          * The following calls seperate the vector interpolation into
          * independent scalar interpolations.
          */
-        typedef typename pmacc::math::CT::make_Int<simDim,supp>::type Supports;
-
         typename Cursor::ValueType result;
         for(uint32_t i = 0; i < Cursor::ValueType::dim; i++)
         {
@@ -90,9 +108,20 @@ struct FieldToParticleInterpolation
                 field,
                 pmacc::algorithm::functor::GetComponent<float_X>(i)
             );
-            floatD_X particlePosShifted = particlePos;
-            ShiftCoordinateSystem<Supports>()(fieldComponent, particlePosShifted, fieldPos[i]);
-            result[i] = InterpolationMethod::template interpolate<AssignmentFunction, begin, end > (fieldComponent, particlePosShifted);
+
+            /* shift to the system where the field component is located on the cell origin */
+            DataSpace< simDim > shift;
+            float_X const * weights[ simDim ];
+            for( uint32_t d = 0; d < simDim; ++d )
+            {
+                AxisWeights const & axisWeights = getAxisWeights( d, fieldPos[ i ][ d ] );
+                shift[ d ] = axisWeights.shift;
+                weights[ d ] = axisWeights.weights;
+            }
+            result[i] = InterpolationMethod::template interpolateWithWeights< begin, end >(
+                fieldComponent( shift ),
+                weights
+            );
         }
 
         return result;
@@ -104,6 +133,53 @@ struct FieldToParticleInterpolation
         return propList;
     }
 
+private:
+
+    //! number of distinct field positions per axis with cached weights
+    static constexpr uint32_t numFieldPositions = 2u;
+
+    //! 1D assignment weights of one axis for one field position
+    struct AxisWeights
+    {
+        float_X fieldPos;
+        //! shift of the coordinate system, see ShiftCoordinateSystem
+        int shift;
+        //! weights of the grid points in [begin;end] after the shift
+        float_X weights[ supp ];
+    };
+
+    /** get the weights of an axis, evaluate them if they are not cached
+     *
+     * @param d axis
+     * @param fieldPos position of the field component in the cell along the axis
+     */
+    HDINLINE AxisWeights const & getAxisWeights(
+        uint32_t const d,
+        float_X const fieldPos
+    )
+    {
+        for( uint32_t s = 0; s < m_numWeights[ d ]; ++s )
+            if( m_weights[ d ][ s ].fieldPos == fieldPos )
+                return m_weights[ d ][ s ];
+
+        /* overwrite the last weights if all are in use (not the case on the Yee grid) */
+        uint32_t const s = m_numWeights[ d ] < numFieldPositions ? m_numWeights[ d ]++ : numFieldPositions - 1u;
+        AxisWeights & axisWeights = m_weights[ d ][ s ];
+
+        constexpr bool isEven = ( supp % 2 ) == 0;
+        float_X const pos = m_particlePos[ d ] - fieldPos;
+        axisWeights.fieldPos = fieldPos;
+        axisWeights.shift = GetOffsetToStaticShapeSystem< isEven >()( pos );
+        float_X const shiftedPos = pos - float_X( axisWeights.shift );
+        for( int p = 0; p < supp; ++p )
+            axisWeights.weights[ p ] = AssignmentFunction()( float_X( begin + p ) - shiftedPos );
+
+        return axisWeights;
+    }
+
+    floatD_X m_particlePos;
+    uint32_t m_numWeights[ simDim ];
+    AxisWeights m_weights[ simDim ][ numFieldPositions ];
 };
 
 namespace traits
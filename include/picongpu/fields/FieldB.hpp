@@ -86,6 +86,17 @@ namespace picongpu
 
         GridBuffer<ValueType, simDim> &getGridBuffer();
 
+        /** second buffer with the layout and guard exchanges of the field
+         *
+         * The buffer is allocated on the first call. Solvers which can not
+         * update the field in place write the new values into this buffer
+         * and call swapGridBuffer() afterwards.
+         */
+        GridBuffer<ValueType, simDim> &getSwapGridBuffer();
+
+        //! exchange the field buffer with the swap buffer
+        void swapGridBuffer();
+
         SimulationDataId getUniqueId();
 
         void synchronize();
@@ -96,7 +107,10 @@ namespace picongpu
 
         void absorbeBorder();
 
+        void addExchanges( GridBuffer<ValueType, simDim>& buffer, uint32_t const commTag );
+
         GridBuffer<ValueType, simDim> *fieldB;
+        GridBuffer<ValueType, simDim> *fieldBSwap;
     };
 
 
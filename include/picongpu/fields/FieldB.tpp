@@ -29,6 +29,7 @@
 #include <pmacc/mappings/kernel/AreaMapping.hpp>
 #include <pmacc/mappings/kernel/ExchangeMapping.hpp>
 #include <pmacc/memory/buffers/GridBuffer.hpp>
+#include <pmacc/traits/GetUniqueTypeId.hpp>
 
 #include "picongpu/fields/FieldManipulator.hpp"
 
@@ -51,6 +52,7 @@
 #include <list>
 #include <iostream>
 #include <memory>
+#include <utility>
 
 
 namespace picongpu
@@ -59,11 +61,16 @@ namespace picongpu
 using namespace pmacc;
 
 FieldB::FieldB( MappingDesc cellDescription ) :
-SimulationFieldHelper<MappingDesc>( cellDescription )
+SimulationFieldHelper<MappingDesc>( cellDescription ),
+fieldBSwap( nullptr )
 {
     /*#####create FieldB###############*/
     fieldB = new GridBuffer<ValueType, simDim > ( cellDescription.getGridLayout( ) );
+    addExchanges( *fieldB, FIELD_B );
+}
 
+void FieldB::addExchanges( GridBuffer<ValueType, simDim>& buffer, uint32_t const commTag )
+{
     typedef typename pmacc::particles::traits::FilterByFlag
     <
         VectorAllSpecies,
@@ -126,14 +133,14 @@ SimulationFieldHelper<MappingDesc>( cellDescription )
         DataSpace<simDim> guardingCells;
         for ( uint32_t d = 0; d < simDim; ++d )
             guardingCells[d] = ( relativMask[d] == -1 ? originGuard[d] : endGuard[d] );
-        fieldB->addExchange( GUARD, i, guardingCells, FIELD_B );
+        buffer.addExchange( GUARD, i, guardingCells, commTag );
     }
-
 }
 
 FieldB::~FieldB( )
 {
     __delete(fieldB);
+    __delete(fieldBSwap);
 }
 
 SimulationDataId FieldB::getUniqueId()
@@ -183,6 +190,23 @@ GridBuffer<FieldB::ValueType, simDim> &FieldB::getGridBuffer( )
     return *fieldB;
 }
 
+GridBuffer<FieldB::ValueType, simDim> &FieldB::getSwapGridBuffer( )
+{
+    if( fieldBSwap == nullptr )
+    {
+        fieldBSwap = new GridBuffer<ValueType, simDim > ( cellDescription.getGridLayout( ) );
+        uint32_t const commTag = ++pmacc::traits::detail::GetUniqueTypeId< uint8_t >::counter +
+            SPECIES_FIRSTTAG;
+        addExchanges( *fieldBSwap, commTag );
+    }
+    return *fieldBSwap;
+}
+
+void FieldB::swapGridBuffer( )
+{
+    std::swap( fieldB, fieldBSwap );
+}
+
 void FieldB::reset( uint32_t )
 {
     fieldB->getHostBuffer( ).reset( true );
@@ -85,6 +85,17 @@ namespace picongpu
 
         GridBuffer<ValueType,simDim>& getGridBuffer();
 
+        /** second buffer with the layout and guard exchanges of the field
+         *
+         * The buffer is allocated on the first call. Solvers which can not
+         * update the field in place write the new values into this buffer
+         * and call swapGridBuffer() afterwards.
+         */
+        GridBuffer<ValueType,simDim>& getSwapGridBuffer();
+
+        //! exchange the field buffer with the swap buffer
+        void swapGridBuffer();
+
         GridLayout<simDim> getGridLayout();
 
         SimulationDataId getUniqueId();
@@ -97,8 +108,11 @@ namespace picongpu
 
         void absorbeBorder();
 
+        void addExchanges( GridBuffer<ValueType,simDim>& buffer, uint32_t const commTag );
+
 
         GridBuffer<ValueType,simDim> *fieldE;
+        GridBuffer<ValueType,simDim> *fieldESwap;
     };
 
 
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <pmacc/memory/buffers/GridBuffer.hpp>
+#include <pmacc/traits/GetUniqueTypeId.hpp>
 #include <pmacc/mappings/simulation/GridController.hpp>
 
 #include <pmacc/dataManagement/DataConnector.hpp>
@@ -47,6 +48,7 @@
 
 #include <list>
 #include <memory>
+#include <utility>
 
 
 namespace picongpu
@@ -54,9 +56,15 @@ namespace picongpu
 using namespace pmacc;
 
 FieldE::FieldE( MappingDesc cellDescription ) :
-SimulationFieldHelper<MappingDesc>( cellDescription )
+SimulationFieldHelper<MappingDesc>( cellDescription ),
+fieldESwap( nullptr )
 {
     fieldE = new GridBuffer<ValueType, simDim > ( cellDescription.getGridLayout( ) );
+    addExchanges( *fieldE, FIELD_E );
+}
+
+void FieldE::addExchanges( GridBuffer<ValueType, simDim>& buffer, uint32_t const commTag )
+{
     typedef typename pmacc::particles::traits::FilterByFlag
     <
         VectorAllSpecies,
@@ -120,13 +128,14 @@ SimulationFieldHelper<MappingDesc>( cellDescription )
         DataSpace<simDim> guardingCells;
         for ( uint32_t d = 0; d < simDim; ++d )
             guardingCells[d] = ( relativMask[d] == -1 ? originGuard[d] : endGuard[d] );
-        fieldE->addExchange( GUARD, i, guardingCells, FIELD_E );
+        buffer.addExchange( GUARD, i, guardingCells, commTag );
     }
 }
 
 FieldE::~FieldE( )
 {
     __delete(fieldE);
+    __delete(fieldESwap);
 }
 
 SimulationDataId FieldE::getUniqueId()
@@ -164,6 +173,23 @@ GridBuffer<FieldE::ValueType, simDim> &FieldE::getGridBuffer( )
     return *fieldE;
 }
 
+GridBuffer<FieldE::ValueType, simDim> &FieldE::getSwapGridBuffer( )
+{
+    if( fieldESwap == nullptr )
+    {
+        fieldESwap = new GridBuffer<ValueType, simDim > ( cellDescription.getGridLayout( ) );
+        uint32_t const commTag = ++pmacc::traits::detail::GetUniqueTypeId< uint8_t >::counter +
+            SPECIES_FIRSTTAG;
+        addExchanges( *fieldESwap, commTag );
+    }
+    return *fieldESwap;
+}
+
+void FieldE::swapGridBuffer( )
+{
+    std::swap( fieldE, fieldESwap );
+}
+
 GridLayout< simDim> FieldE::getGridLayout( )
 {
     return cellDescription.getGridLayout( );
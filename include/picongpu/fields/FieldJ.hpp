@@ -40,6 +40,7 @@
 
 #include <pmacc/math/Vector.hpp>
 #include "picongpu/particles/Particles.hpp"
+#include "picongpu/particles/traits/HasFusedCurrent.hpp"
 
 namespace picongpu
 {
@@ -154,6 +155,10 @@ struct ComputeCurrent
 
     HINLINE void operator()( const uint32_t currentStep ) const
     {
+        // the current was already deposited by the push kernel
+        if( particles::traits::HasFusedCurrent< SpeciesType >::type::value )
+            return;
+
         DataConnector &dc = Environment<>::get().DataConnector();
         auto species = dc.get< SpeciesType >( FrameType::getName(), true );
         auto fieldJ = dc.get< FieldJ >( FieldJ::getName(), true );
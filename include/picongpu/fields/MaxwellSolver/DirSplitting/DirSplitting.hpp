@@ -34,6 +34,7 @@
 #include <pmacc/math/vector/TwistComponents.hpp>
 #include <pmacc/math/vector/compile-time/TwistComponents.hpp>
 #include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/traits/GetNumWorkers.hpp>
 
 
 namespace picongpu
@@ -98,11 +99,18 @@ namespace dirSplitting
             /* twist components of the supercell */
             using BlockDim = typename CT::TwistComponents<SuperCellSize, OrientationTwist>::type;
 
-            algorithm::kernel::ForeachBlock<BlockDim> foreach;
+            constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+                CT::volume< BlockDim >::type::value
+            >::value;
+
+            algorithm::kernel::ForeachBlock<
+                BlockDim,
+                CT::Int< numWorkers, 1, 1 >
+            > foreach;
             foreach(zone::SphericZone<3>(pmacc::math::Size_t<3>(BlockDim::x::value, gridSizeTwisted.y(), gridSizeTwisted.z())),
                     cursor::make_NestedCursor(twistVectorFieldAxes<OrientationTwist>(cursorE)),
                     cursor::make_NestedCursor(twistVectorFieldAxes<OrientationTwist>(cursorB)),
-                    DirSplittingKernel<BlockDim>((int)gridSizeTwisted.x()));
+                    DirSplittingKernel< numWorkers, BlockDim >((int)gridSizeTwisted.x()));
         }
     public:
 
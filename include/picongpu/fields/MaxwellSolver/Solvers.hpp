@@ -23,9 +23,8 @@
 
 #include "picongpu/fields/MaxwellSolver/None/None.hpp"
 #include "picongpu/fields/MaxwellSolver/Yee/Yee.hpp"
+#include "picongpu/fields/MaxwellSolver/YeeFused/YeeFused.hpp"
 #if (SIMDIM==3)
 #include "picongpu/fields/MaxwellSolver/Lehe/Lehe.hpp"
-#if( PMACC_CUDA_ENABLED == 1 )
-#   include "picongpu/fields/MaxwellSolver/DirSplitting/DirSplitting.hpp"
-#endif
+#include "picongpu/fields/MaxwellSolver/DirSplitting/DirSplitting.hpp"
 #endif
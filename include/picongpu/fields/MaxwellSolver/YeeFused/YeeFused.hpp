@@ -0,0 +1,258 @@
+/* Copyright 2018 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+#include "picongpu/fields/MaxwellSolver/YeeFused/YeeFused.def"
+#include "picongpu/fields/MaxwellSolver/YeeFused/YeeFused.kernel"
+#include "picongpu/fields/MaxwellSolver/Yee/Curl.hpp"
+#include "picongpu/fields/MaxwellSolver/Yee/Yee.kernel"
+#include "picongpu/fields/FieldManipulator.hpp"
+#include "picongpu/fields/FieldE.hpp"
+#include "picongpu/fields/FieldB.hpp"
+#include "picongpu/fields/numericalCellTypes/NumericalCellTypes.hpp"
+#include "picongpu/fields/LaserPhysics.hpp"
+
+#include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/math/vector/compile-time/Vector.hpp>
+
+
+namespace picongpu
+{
+namespace fields
+{
+namespace maxwellSolver
+{
+
+    template<
+        typename T_CurrentInterpolation,
+        class CurlE,
+        class CurlB
+    >
+    class YeeFused
+    {
+    private:
+        typedef MappingDesc::SuperCellSize SuperCellSize;
+
+        std::shared_ptr< FieldE > fieldE;
+        std::shared_ptr< FieldB > fieldB;
+        MappingDesc m_cellDescription;
+
+        template<
+            uint32_t AREA,
+            typename T_EBox,
+            typename T_BBox
+        >
+        void updateE(
+            T_EBox fieldEBox,
+            T_BBox fieldBBox
+        )
+        {
+            typedef SuperCellDescription<
+                    SuperCellSize,
+                    typename CurlB::LowerMargin,
+                    typename CurlB::UpperMargin
+                    > BlockArea;
+
+            AreaMapping<AREA, MappingDesc> mapper(m_cellDescription);
+
+            constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+                pmacc::math::CT::volume< SuperCellSize >::type::value
+            >::value;
+
+            PMACC_KERNEL(yee::KernelUpdateE< numWorkers, BlockArea >{ })
+                ( mapper.getGridDim(), numWorkers )(
+                    CurlB( ),
+                    fieldEBox,
+                    fieldBBox,
+                    mapper
+                );
+        }
+
+        template<
+            uint32_t AREA,
+            typename T_EBox,
+            typename T_BBox
+        >
+        void updateBHalf(
+            T_BBox fieldBBox,
+            T_EBox fieldEBox
+        )
+        {
+            typedef SuperCellDescription<
+                    SuperCellSize,
+                    typename CurlE::LowerMargin,
+                    typename CurlE::UpperMargin
+                    > BlockArea;
+
+            AreaMapping<AREA, MappingDesc> mapper(m_cellDescription);
+
+            constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+                pmacc::math::CT::volume< SuperCellSize >::type::value
+            >::value;
+
+            PMACC_KERNEL(yee::KernelUpdateBHalf< numWorkers, BlockArea >{ })
+                ( mapper.getGridDim(), numWorkers )(
+                    CurlE( ),
+                    fieldBBox,
+                    fieldEBox,
+                    mapper
+                );
+        }
+
+        //! half step of B and update of E, the results are written to the swap buffers
+        template< uint32_t AREA >
+        void updateBHalfE()
+        {
+            typedef SuperCellDescription<
+                    SuperCellSize,
+                    typename CurlB::LowerMargin,
+                    typename CurlB::UpperMargin
+                    > BlockAreaB;
+
+            typedef SuperCellDescription<
+                    SuperCellSize,
+                    typename pmacc::math::CT::add<
+                        typename CurlB::LowerMargin,
+                        typename CurlE::LowerMargin
+                    >::type,
+                    typename pmacc::math::CT::add<
+                        typename CurlB::UpperMargin,
+                        typename CurlE::UpperMargin
+                    >::type
+                    > BlockAreaE;
+
+            AreaMapping<AREA, MappingDesc> mapper(m_cellDescription);
+
+            constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+                pmacc::math::CT::volume< SuperCellSize >::type::value
+            >::value;
+
+            PMACC_KERNEL(yeeFused::KernelUpdateBHalfE< numWorkers, BlockAreaE, BlockAreaB >{ })
+                ( mapper.getGridDim(), numWorkers )(
+                    CurlE( ),
+                    CurlB( ),
+                    this->fieldE->getSwapGridBuffer().getDeviceBuffer().getDataBox(),
+                    this->fieldB->getSwapGridBuffer().getDeviceBuffer().getDataBox(),
+                    this->fieldE->getDeviceDataBox(),
+                    this->fieldB->getDeviceDataBox(),
+                    mapper
+                );
+        }
+
+        //! copy both fields to the swap buffers
+        template< uint32_t AREA >
+        void copyToSwapBuffers()
+        {
+            AreaMapping<AREA, MappingDesc> mapper(m_cellDescription);
+
+            constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+                pmacc::math::CT::volume< SuperCellSize >::type::value
+            >::value;
+
+            PMACC_KERNEL(yeeFused::KernelCopySuperCells< numWorkers >{ })
+                ( mapper.getGridDim(), numWorkers )(
+                    this->fieldE->getSwapGridBuffer().getDeviceBuffer().getDataBox(),
+                    this->fieldE->getDeviceDataBox(),
+                    mapper
+                );
+
+            PMACC_KERNEL(yeeFused::KernelCopySuperCells< numWorkers >{ })
+                ( mapper.getGridDim(), numWorkers )(
+                    this->fieldB->getSwapGridBuffer().getDeviceBuffer().getDataBox(),
+                    this->fieldB->getDeviceDataBox(),
+                    mapper
+                );
+        }
+
+    public:
+
+        using NummericalCellType = picongpu::numericalCellTypes::YeeCell;
+        using CurrentInterpolation = T_CurrentInterpolation;
+
+        YeeFused(MappingDesc cellDescription) : m_cellDescription(cellDescription)
+        {
+            DataConnector &dc = Environment<>::get().DataConnector();
+
+            this->fieldE = dc.get< FieldE >( FieldE::getName(), true );
+            this->fieldB = dc.get< FieldB >( FieldB::getName(), true );
+
+            // allocate the swap buffers
+            this->fieldE->getSwapGridBuffer();
+            this->fieldB->getSwapGridBuffer();
+        }
+
+        void update_beforeCurrent(uint32_t)
+        {
+            /* Courant-Friedrichs-Levy-Condition for Yee Field Solver: */
+            PMACC_CASSERT_MSG(Courant_Friedrichs_Levy_condition_failure____check_your_grid_param_file,
+                (SPEED_OF_LIGHT*SPEED_OF_LIGHT*DELTA_T*DELTA_T*INV_CELL2_SUM)<=1.0);
+
+            /* The GUARD keeps its values (except B received from the neighbors)
+             * and the BORDER is updated in place within the swap buffers.
+             */
+            copyToSwapBuffers< GUARD >();
+            copyToSwapBuffers< BORDER >();
+
+            auto newFieldE = fieldE->getSwapGridBuffer().getDeviceBuffer().getDataBox();
+            auto newFieldB = fieldB->getSwapGridBuffer().getDeviceBuffer().getDataBox();
+
+            updateBHalf< BORDER >( newFieldB, fieldE->getDeviceDataBox() );
+            EventTask eRfieldB = fieldB->getSwapGridBuffer().asyncCommunication(__getTransactionEvent());
+
+            /* CORE supercells only access CORE and BORDER cells, the B margin
+             * required for E is calculated redundantly
+             */
+            updateBHalfE< CORE >();
+            __setTransactionEvent(eRfieldB);
+            updateE< BORDER >( newFieldE, newFieldB );
+
+            fieldE->swapGridBuffer();
+            fieldB->swapGridBuffer();
+        }
+
+        void update_afterCurrent(uint32_t currentStep)
+        {
+            FieldManipulator::absorbBorder(currentStep,this->m_cellDescription, this->fieldE->getDeviceDataBox());
+            if (laserProfiles::Selected::INIT_TIME > float_X(0.0))
+                LaserPhysics{}(currentStep);
+
+            EventTask eRfieldE = fieldE->asyncCommunication(__getTransactionEvent());
+
+            updateBHalf < CORE> ( fieldB->getDeviceDataBox(), fieldE->getDeviceDataBox() );
+            __setTransactionEvent(eRfieldE);
+            updateBHalf < BORDER > ( fieldB->getDeviceDataBox(), fieldE->getDeviceDataBox() );
+
+            FieldManipulator::absorbBorder(currentStep,this->m_cellDescription, fieldB->getDeviceDataBox());
+
+            EventTask eRfieldB = fieldB->asyncCommunication(__getTransactionEvent());
+            __setTransactionEvent(eRfieldB);
+        }
+
+        static pmacc::traits::StringProperty getStringProperties()
+        {
+            pmacc::traits::StringProperty propList( "name", "YeeFused" );
+            return propList;
+        }
+    };
+
+} // namespace maxwellSolver
+} // namespace fields
+} // picongpu
@@ -21,7 +21,7 @@
 
 #include <pmacc/cuSTL/cursor/Cursor.hpp>
 #include <pmacc/cuSTL/cursor/tools/twistVectorFieldAxes.hpp>
-#include <pmacc/nvidia/atomic.hpp>
+#include "picongpu/fields/currentDeposition/Strategy.hpp"
 
 #include "picongpu/fields/currentDeposition/EmZ/EmZ.def"
 #include "picongpu/fields/currentDeposition/Esirkepov/Line.hpp"
@@ -190,10 +190,10 @@ namespace emz
                          */
                         const float_X W = this->DS( line, k, 2 ) * tmp;
                         accumulated_J += W;
-                        atomicAdd(
-                            &( (*cursorJ( i, j, k ) ).z( ) ),
-                            accumulated_J,
-                            ::alpaka::hierarchy::Threads{}
+                        addCurrent(
+                            acc,
+                            (*cursorJ( i, j, k ) ).z( ),
+                            accumulated_J
                         );
                     }
                 }
@@ -289,10 +289,10 @@ namespace emz
                      */
                     const float_X W = this->DS( line, i, 0 ) * tmp;
                     accumulated_J += W;
-                    atomicAdd(
-                        &( ( *cursorJ( i, j ) ).x( ) ),
-                        accumulated_J,
-                        ::alpaka::hierarchy::Threads{}
+                    addCurrent(
+                        acc,
+                        ( *cursorJ( i, j ) ).x( ),
+                        accumulated_J
                     );
                 }
             }
@@ -333,10 +333,10 @@ namespace emz
                         ( float_X( 1.0 ) / float_X( 3.0 ) ) * dsi * dsj;
 
                     const float_X j_z = W * currentSurfaceDensityZ;
-                    atomicAdd(
-                        &( ( *cursorJ( i, j ) ).z( ) ),
-                        j_z,
-                        ::alpaka::hierarchy::Threads{}
+                    addCurrent(
+                        acc,
+                        ( *cursorJ( i, j ) ).z( ),
+                        j_z
                     );
                 }
             }
@@ -25,7 +25,7 @@
 #include <pmacc/cuSTL/cursor/Cursor.hpp>
 #include <pmacc/cuSTL/cursor/tools/twistVectorFieldAxes.hpp>
 #include <pmacc/cuSTL/cursor/compile-time/SafeCursor.hpp>
-#include <pmacc/nvidia/atomic.hpp>
+#include "picongpu/fields/currentDeposition/Strategy.hpp"
 
 #include "picongpu/fields/currentDeposition/Esirkepov/Line.hpp"
 
@@ -155,7 +155,7 @@ struct EsirkepovNative
                     /* We multiply with `cellEdgeLength` due to the fact that the attribute for the
                      * in-cell particle `position` (and it's change in DELTA_T) is normalize to [0,1) */
                     accumulated_J += -this->charge * (float_X(1.0) / float_X(CELL_VOLUME * DELTA_T)) * W * cellEdgeLength;
-                    atomicAdd(&((*cursorJ(i, j, k)).z()), accumulated_J, ::alpaka::hierarchy::Threads{});
+                    addCurrent(acc, (*cursorJ(i, j, k)).z(), accumulated_J);
                 }
             }
         }
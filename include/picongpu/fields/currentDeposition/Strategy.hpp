@@ -0,0 +1,371 @@
+/* Copyright 2018 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+#include "picongpu/algorithms/Set.hpp"
+
+#include <pmacc/types.hpp>
+#include <pmacc/static_assert.hpp>
+#include <pmacc/dimensions/DataSpaceOperations.hpp>
+#include <pmacc/mappings/threads/ForEachIdx.hpp>
+#include <pmacc/mappings/threads/IdxConfig.hpp>
+#include <pmacc/mappings/threads/ThreadCollective.hpp>
+#include <pmacc/memory/Array.hpp>
+#include <pmacc/memory/boxes/CachedBox.hpp>
+#include <pmacc/memory/boxes/DataBox.hpp>
+#include <pmacc/memory/boxes/SharedBox.hpp>
+#include <pmacc/memory/shared/Allocate.hpp>
+#include <pmacc/nvidia/atomic.hpp>
+#include <pmacc/nvidia/functors/Add.hpp>
+
+
+namespace picongpu
+{
+namespace currentSolver
+{
+namespace strategy
+{
+
+    /** all workers of a block deposit into one cached supercell
+     *
+     * Contributions are added with atomic operations between the workers of
+     * a block. The cache is added to the global current once per supercell.
+     */
+    struct SharedAtomic
+    {
+        /** add a contribution to the cached current
+         *
+         * @param acc alpaka accelerator
+         * @param dest component of the cached current
+         * @param value contribution
+         */
+        template<
+            typename T_Acc,
+            typename T_Type
+        >
+        static DINLINE void add(
+            T_Acc const & acc,
+            T_Type & dest,
+            T_Type const value
+        )
+        {
+            atomicAdd( &dest, value, ::alpaka::hierarchy::Threads{} );
+        }
+
+        /** current cache of a supercell
+         *
+         * @tparam T_ValueType type of the current
+         * @tparam T_BlockDescription current field domain description
+         * @tparam T_numWorkers number of workers
+         * @tparam T_id unique id of the shared memory within the kernel
+         */
+        template<
+            typename T_ValueType,
+            typename T_BlockDescription,
+            uint32_t T_numWorkers,
+            uint32_t T_id = 0u
+        >
+        struct Cache
+        {
+            using Box = typename pmacc::intern::CachedBox<
+                T_ValueType,
+                T_BlockDescription,
+                T_id
+            >::Type;
+
+            template< typename T_Acc >
+            DINLINE Cache(
+                T_Acc const & acc,
+                uint32_t const workerIdx
+            ) :
+                m_box(
+                    pmacc::CachedBox::create<
+                        T_id,
+                        T_ValueType
+                    >(
+                        acc,
+                        T_BlockDescription()
+                    )
+                ),
+                m_workerIdx( workerIdx )
+            {
+            }
+
+            //! box used by the worker to deposit the current
+            DINLINE Box & getBox()
+            {
+                return m_box;
+            }
+
+            //! initialize the cache with zeros
+            template< typename T_Acc >
+            DINLINE void setZero( T_Acc const & acc )
+            {
+                Set< T_ValueType > set( T_ValueType::create( 0.0 ) );
+                pmacc::ThreadCollective<
+                    T_BlockDescription,
+                    T_numWorkers
+                > collectiveSet( m_workerIdx );
+
+                collectiveSet( acc, set, m_box );
+            }
+
+            /** add the cache to the current of the supercell
+             *
+             * @param acc alpaka accelerator
+             * @param fieldJBlock current box shifted to the origin of the supercell
+             */
+            template<
+                typename T_Acc,
+                typename T_JBox
+            >
+            DINLINE void addTo(
+                T_Acc const & acc,
+                T_JBox fieldJBlock
+            )
+            {
+                pmacc::nvidia::functors::Add add;
+                pmacc::ThreadCollective<
+                    T_BlockDescription,
+                    T_numWorkers
+                > collectiveAdd( m_workerIdx );
+
+                collectiveAdd( acc, add, fieldJBlock, m_box );
+            }
+
+        private:
+            Box m_box;
+            uint32_t const m_workerIdx;
+        };
+    };
+
+    /** each worker deposits into a private copy of the cached supercell
+     *
+     * Contributions are added without atomic operations. All copies are
+     * summed once per supercell while they are added to the global current.
+     * The cache needs T_numWorkers times more shared memory than SharedAtomic,
+     * therefore this strategy is only used for CPU accelerators with several
+     * threads per block, where shared memory is host memory and atomic
+     * operations between threads are implemented with locks.
+     */
+    struct PrivateTile
+    {
+        /** upper bound of the shared memory for all tiles of a block in byte
+         *
+         * Keeps the tiles of a block within the cache of a CPU socket for
+         * common supercell sizes and shapes, e.g. 256 workers with 8x8x4
+         * supercells and TSC shape (about 2.6 MiB).
+         */
+        static constexpr size_t maxSharedMemBytes = 4u * 1024u * 1024u;
+
+        /** add a contribution to the cached current
+         *
+         * @param acc alpaka accelerator
+         * @param dest component of the cached current
+         * @param value contribution
+         */
+        template<
+            typename T_Acc,
+            typename T_Type
+        >
+        static DINLINE void add(
+            T_Acc const &,
+            T_Type & dest,
+            T_Type const value
+        )
+        {
+            dest += value;
+        }
+
+        /** current cache of a supercell with one tile per worker
+         *
+         * @tparam T_ValueType type of the current
+         * @tparam T_BlockDescription current field domain description
+         * @tparam T_numWorkers number of workers
+         * @tparam T_id unique id of the shared memory within the kernel
+         */
+        template<
+            typename T_ValueType,
+            typename T_BlockDescription,
+            uint32_t T_numWorkers,
+            uint32_t T_id = 0u
+        >
+        struct Cache
+        {
+            using FullSuperCellSize = typename T_BlockDescription::FullSuperCellSize;
+            using OffsetOrigin = typename T_BlockDescription::OffsetOrigin;
+            using TileBox = pmacc::SharedBox<
+                T_ValueType,
+                FullSuperCellSize,
+                T_id
+            >;
+            using Box = pmacc::DataBox< TileBox >;
+
+            //! number of elements in the tile of one worker
+            static constexpr uint32_t tileSize = pmacc::math::CT::volume< FullSuperCellSize >::type::value;
+
+            PMACC_CASSERT_MSG(
+                __PrivateTile_tiles_of_all_workers_exceed_maxSharedMemBytes__use_smaller_supercells_or_SharedAtomic,
+                sizeof( T_ValueType ) * tileSize * T_numWorkers <= maxSharedMemBytes
+            );
+
+            template< typename T_Acc >
+            DINLINE Cache(
+                T_Acc const & acc,
+                uint32_t const workerIdx
+            ) :
+                m_tiles(
+                    pmacc::memory::shared::allocate<
+                        T_id,
+                        pmacc::memory::Array<
+                            T_ValueType,
+                            tileSize * T_numWorkers
+                        >
+                    >( acc ).data()
+                ),
+                m_workerIdx( workerIdx ),
+                m_box(
+                    Box(
+                        TileBox( m_tiles + tileSize * workerIdx )
+                    ).shift( DataSpace< simDim >( OffsetOrigin::toRT() ) )
+                )
+            {
+            }
+
+            //! box used by the worker to deposit the current
+            DINLINE Box & getBox()
+            {
+                return m_box;
+            }
+
+            //! initialize the tile of the worker with zeros
+            template< typename T_Acc >
+            DINLINE void setZero( T_Acc const & )
+            {
+                T_ValueType * const tile = m_tiles + tileSize * m_workerIdx;
+                for( uint32_t i = 0u; i < tileSize; ++i )
+                    tile[ i ] = T_ValueType::create( 0.0 );
+            }
+
+            /** sum all tiles and add them to the current of the supercell
+             *
+             * @param acc alpaka accelerator
+             * @param fieldJBlock current box shifted to the origin of the supercell
+             */
+            template<
+                typename T_Acc,
+                typename T_JBox
+            >
+            DINLINE void addTo(
+                T_Acc const &,
+                T_JBox fieldJBlock
+            )
+            {
+                using namespace pmacc::mappings::threads;
+
+                T_ValueType const * const tiles = m_tiles;
+                ForEachIdx<
+                    IdxConfig<
+                        tileSize,
+                        T_numWorkers
+                    >
+                >{ m_workerIdx }(
+                    [&](
+                        uint32_t const linearIdx,
+                        uint32_t const
+                    )
+                    {
+                        T_ValueType sum = tiles[ linearIdx ];
+                        for( uint32_t t = 1u; t < T_numWorkers; ++t )
+                            sum += tiles[ t * tileSize + linearIdx ];
+
+                        DataSpace< simDim > const offset(
+                            DataSpaceOperations< simDim >::template map< FullSuperCellSize >( linearIdx ) -
+                            OffsetOrigin::toRT()
+                        );
+                        fieldJBlock( offset ) += sum;
+                    }
+                );
+            }
+
+        private:
+            T_ValueType * const m_tiles;
+            uint32_t const m_workerIdx;
+            Box m_box;
+        };
+    };
+
+} // namespace strategy
+
+    /** get the current deposition strategy of an accelerator
+     *
+     * CPU accelerators with several threads per block use PrivateTile, all
+     * others SharedAtomic. Accelerators with one worker per block do not
+     * contend on the cache and their atomic operations between threads are
+     * plain additions already.
+     *
+     * @tparam T_Acc the accelerator type
+     * @return @p ::type strategy::SharedAtomic or strategy::PrivateTile
+     */
+    template< typename T_Acc = cupla::AccThreadSeq >
+    struct GetDepositionStrategy
+    {
+        using type = strategy::SharedAtomic;
+    };
+
+#if( ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED == 1 )
+    template< typename ... T_Args >
+    struct GetDepositionStrategy< alpaka::acc::AccCpuOmp2Threads< T_Args... > >
+    {
+        using type = strategy::PrivateTile;
+    };
+#endif
+#if( ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED == 1 )
+    template< typename ... T_Args >
+    struct GetDepositionStrategy< alpaka::acc::AccCpuThreads< T_Args... > >
+    {
+        using type = strategy::PrivateTile;
+    };
+#endif
+
+    /** add a contribution to the cached current
+     *
+     * Uses the deposition strategy of the accelerator.
+     *
+     * @param acc alpaka accelerator
+     * @param dest component of the cached current
+     * @param value contribution
+     */
+    template<
+        typename T_Acc,
+        typename T_Type
+    >
+    DINLINE void addCurrent(
+        T_Acc const & acc,
+        T_Type & dest,
+        T_Type const value
+    )
+    {
+        GetDepositionStrategy< T_Acc >::type::add( acc, dest, value );
+    }
+
+} // namespace currentSolver
+} // namespace picongpu
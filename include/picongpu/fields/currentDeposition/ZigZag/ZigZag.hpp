@@ -34,6 +34,7 @@
 #include <boost/mpl/if.hpp>
 #include <pmacc/compileTime/AllCombinations.hpp>
 #include "picongpu/fields/currentDeposition/ZigZag/EvalAssignmentFunction.hpp"
+#include "picongpu/fields/currentDeposition/Strategy.hpp"
 #include "picongpu/fields/MaxwellSolver/Solvers.hpp"
 #include "picongpu/traits/FieldPosition.hpp"
 
@@ -136,7 +137,7 @@ struct AssignChargeToCell
         /* shift memory cursor to cell (grid point)*/
         auto cursorToValue = cursor(GridPointVec::toRT());
         /* add current to component of the cell*/
-        atomicAdd(&((*cursorToValue)[currentComponent]), j, ::alpaka::hierarchy::Threads{});
+        addCurrent(acc, (*cursorToValue)[currentComponent], j);
     }
 };
 
@@ -184,7 +184,9 @@ public:
     {
         SimStartInitialiser simStartInitialiser;
         Environment<>::get().DataConnector().initialise(simStartInitialiser, currentStep);
-        __getTransactionEvent().waitForFinished();
+        /* no wait for the reset of the new domain, the initialization of the
+         * species is ordered after it by the event system
+         */
     }
 
 private:
@@ -29,7 +29,9 @@ namespace picongpu
  *
  * This functor is a simplification of the full
  * field to particle interpolator that can be used in the
- * particle pusher
+ * particle pusher.
+ * The interpolator object is not owned, functors sharing one interpolator
+ * (e.g. for E and B) can reuse the assignment weights of the particle.
  */
 template< typename T_Field2PartInt, typename T_MemoryType, typename T_FieldPosition >
 struct InterpolationForPusher
@@ -37,8 +39,8 @@ struct InterpolationForPusher
     using Field2PartInt = T_Field2PartInt;
 
     HDINLINE
-    InterpolationForPusher( const T_MemoryType& mem, const T_FieldPosition& fieldPos )
-        : m_mem( mem ), m_fieldPos( fieldPos )
+    InterpolationForPusher( Field2PartInt& field2PartInt, const T_MemoryType& mem, const T_FieldPosition& fieldPos )
+        : m_field2PartInt( &field2PartInt ), m_mem( mem ), m_fieldPos( fieldPos )
     {
     }
 
@@ -47,7 +49,7 @@ struct InterpolationForPusher
     HDINLINE
     float3_X operator()( const T_PosType& pos, const T_ShiftPolicy& shiftPolicy ) const
     {
-        return Field2PartInt()( shiftPolicy.memory(m_mem, pos),
+        return ( *m_field2PartInt )( shiftPolicy.memory(m_mem, pos),
                                 shiftPolicy.position(pos),
                                 m_fieldPos );
     }
@@ -57,7 +59,7 @@ struct InterpolationForPusher
     HDINLINE
     float3_X operator()( const T_PosType& pos ) const
     {
-        return Field2PartInt()( m_mem,
+        return ( *m_field2PartInt )( m_mem,
                                 pos,
                                 m_fieldPos );
     }
@@ -65,6 +67,7 @@ struct InterpolationForPusher
 
 
 private:
+    PMACC_ALIGN( m_field2PartInt, Field2PartInt* );
     PMACC_ALIGN( m_mem, T_MemoryType );
     PMACC_ALIGN( m_fieldPos, const T_FieldPosition );
 };
@@ -73,6 +76,8 @@ private:
 /** functor to create particle field interpolator
  *
  * required to get interpolator for pusher
+ *
+ * @param field2PartInt interpolator, must be valid as long as the returned functor is used
  */
 template<typename T_Field2PartInt>
 struct CreateInterpolationForPusher
@@ -80,9 +85,9 @@ struct CreateInterpolationForPusher
     template< typename T_MemoryType, typename T_FieldPosition >
     HDINLINE
     InterpolationForPusher< T_Field2PartInt, T_MemoryType, T_FieldPosition >
-    operator()( const T_MemoryType& mem, const T_FieldPosition& fieldPos )
+    operator()( T_Field2PartInt& field2PartInt, const T_MemoryType& mem, const T_FieldPosition& fieldPos )
     {
-        return InterpolationForPusher< T_Field2PartInt, T_MemoryType, T_FieldPosition >( mem, fieldPos );
+        return InterpolationForPusher< T_Field2PartInt, T_MemoryType, T_FieldPosition >( field2PartInt, mem, fieldPos );
     }
 };
 
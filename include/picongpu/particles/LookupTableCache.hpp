@@ -0,0 +1,300 @@
+/* Copyright 2018 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include <pmacc/Environment.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace picongpu
+{
+namespace particles
+{
+
+    /** lookup tables which are computed once and kept in cache files
+     *
+     * The entries of a table are computed distributed over all ranks. If a
+     * cache directory is set, the first rank writes the table to a file and
+     * later starts with the same key read the file and broadcast the table.
+     */
+    class LookupTableCache
+    {
+    public:
+
+        /** version of the file format
+         *
+         * Increase the version if the file format changes. Changes of the
+         * computation of a table must be contained in the key of the table.
+         */
+        static constexpr uint32_t version = 1u;
+
+        static LookupTableCache & getInstance()
+        {
+            static LookupTableCache instance;
+            return instance;
+        }
+
+        /** set the directory of the cache files
+         *
+         * @param directory directory path, an empty string disables the cache
+         */
+        void setDirectory( std::string const & directory )
+        {
+            m_directory = directory;
+        }
+
+        /** create a key from the values a table depends on
+         *
+         * Floating point values are written with full precision.
+         *
+         * @param name name of the table
+         * @return stream to append `name=value` pairs to
+         */
+        static std::stringstream createKey( std::string const & name )
+        {
+            std::stringstream key;
+            key << std::setprecision( std::numeric_limits< float_64 >::max_digits10 )
+                << name << " sizeof(float_X)=" << sizeof( float_X );
+            return key;
+        }
+
+        /** get a lookup table
+         *
+         * All ranks must call this method collectively with the same arguments.
+         *
+         * @param name name of the table, used in the file name
+         * @param key description of all parameters the table depends on,
+         *            a cache file is used only if its key matches exactly
+         * @param numEntries number of entries of the table
+         * @param valuesPerEntry number of values per entry
+         * @param computeEntry functor `void( uint32_t entryIdx, float_X * values )`
+         *                     computing the `valuesPerEntry` values of an entry
+         * @return values of all entries, entry after entry
+         */
+        template< typename T_ComputeEntry >
+        std::vector< float_X > getTable(
+            std::string const & name,
+            std::string const & key,
+            uint32_t const numEntries,
+            uint32_t const valuesPerEntry,
+            T_ComputeEntry computeEntry
+        ) const
+        {
+            pmacc::GridController< simDim > & gc = pmacc::Environment< simDim >::get().GridController();
+            MPI_Comm comm = gc.getCommunicator().getMPIComm();
+            int const rank = static_cast< int >( gc.getGlobalRank() );
+            int const numRanks = static_cast< int >( gc.getGlobalSize() );
+
+            std::vector< float_X > table( size_t( numEntries ) * valuesPerEntry );
+            int const entryBytes = static_cast< int >( valuesPerEntry * sizeof( float_X ) );
+            std::string const header = getHeader( key, table.size() );
+            std::string const fileName = getFileName( name, key );
+
+            int isCached = 0;
+            if( rank == 0 && !fileName.empty() )
+                isCached = read( fileName, header, table ) ? 1 : 0;
+            MPI_CHECK( MPI_Bcast( &isCached, 1, MPI_INT, 0, comm ) );
+
+            if( isCached == 1 )
+            {
+                MPI_CHECK( MPI_Bcast( table.data(), numEntries * entryBytes, MPI_BYTE, 0, comm ) );
+                log< picLog::PHYSICS >( "lookup table %1% loaded from %2%" ) % name % fileName;
+                return table;
+            }
+
+            /* rank r computes the entries r, r + numRanks, ... to balance
+             * entries with different costs, e.g. integrals with a sample
+             * dependent range
+             */
+            std::vector< int > byteCounts( numRanks );
+            std::vector< int > byteOffsets( numRanks );
+            int offset = 0;
+            for( int r = 0; r < numRanks; ++r )
+            {
+                byteCounts[ r ] = static_cast< int >( getNumEntries( r, numRanks, numEntries ) ) * entryBytes;
+                byteOffsets[ r ] = offset;
+                offset += byteCounts[ r ];
+            }
+
+            // entries of all ranks, rank after rank
+            std::vector< float_X > gathered( table.size() );
+            float_X * localEntries = gathered.data() + byteOffsets[ rank ] / sizeof( float_X );
+            for( uint32_t entryIdx = rank, i = 0; entryIdx < numEntries; entryIdx += numRanks, ++i )
+                computeEntry( entryIdx, localEntries + size_t( i ) * valuesPerEntry );
+
+            MPI_CHECK( MPI_Allgatherv(
+                MPI_IN_PLACE,
+                0,
+                MPI_DATATYPE_NULL,
+                gathered.data(),
+                byteCounts.data(),
+                byteOffsets.data(),
+                MPI_BYTE,
+                comm
+            ) );
+
+            for( int r = 0; r < numRanks; ++r )
+            {
+                float_X const * rankEntries = gathered.data() + byteOffsets[ r ] / sizeof( float_X );
+                for( uint32_t entryIdx = r, i = 0; entryIdx < numEntries; entryIdx += numRanks, ++i )
+                    std::copy(
+                        rankEntries + size_t( i ) * valuesPerEntry,
+                        rankEntries + size_t( i + 1 ) * valuesPerEntry,
+                        table.data() + size_t( entryIdx ) * valuesPerEntry
+                    );
+            }
+
+            if( rank == 0 && !fileName.empty() )
+                write( fileName, header, table );
+
+            return table;
+        }
+
+    private:
+
+        LookupTableCache() = default;
+
+        //! number of entries computed by a rank
+        static uint32_t getNumEntries(
+            int const rank,
+            int const numRanks,
+            uint32_t const numEntries
+        )
+        {
+            return numEntries / numRanks + ( static_cast< uint32_t >( rank ) < numEntries % numRanks ? 1u : 0u );
+        }
+
+        static std::string getHeader(
+            std::string const & key,
+            size_t const numValues
+        )
+        {
+            std::stringstream header;
+            header << "PIConGPU lookup table cache version " << version << "\n"
+                   << "values " << numValues << "\n"
+                   << "key " << key.size() << " " << key << "\n";
+            return header.str();
+        }
+
+        /** get the path of the cache file
+         *
+         * @return empty string if the cache is disabled
+         */
+        std::string getFileName(
+            std::string const & name,
+            std::string const & key
+        ) const
+        {
+            if( m_directory.empty() )
+                return std::string();
+
+            /* the hash separates tables of different keys, a collision is
+             * detected by the full key in the header
+             */
+            std::stringstream fileName;
+            fileName << name << "_" << std::hex << std::setw( 16 ) << std::setfill( '0' )
+                     << static_cast< uint64_t >( std::hash< std::string >()( key ) ) << ".bin";
+            return ( boost::filesystem::path( m_directory ) / fileName.str() ).string();
+        }
+
+        static bool read(
+            std::string const & fileName,
+            std::string const & header,
+            std::vector< float_X > & table
+        )
+        {
+            std::ifstream file( fileName.c_str(), std::ios::binary );
+            if( !file )
+                return false;
+
+            std::string fileHeader( header.size(), '\0' );
+            file.read( &fileHeader[ 0 ], fileHeader.size() );
+            if( !file || fileHeader != header )
+            {
+                log< picLog::PHYSICS >( "lookup table cache file %1% does not match the table and is ignored" ) % fileName;
+                return false;
+            }
+
+            file.read( reinterpret_cast< char * >( table.data() ), table.size() * sizeof( float_X ) );
+            // the file must end after the values
+            if( !file || file.peek() != std::ifstream::traits_type::eof() )
+            {
+                log< picLog::PHYSICS >( "lookup table cache file %1% is corrupt and is ignored" ) % fileName;
+                return false;
+            }
+            return true;
+        }
+
+        /** write a cache file
+         *
+         * The file is written under a temporary name and renamed afterwards,
+         * therefore simulations started at the same time never read a partial file.
+         * A failure to write the file is not fatal.
+         */
+        static void write(
+            std::string const & fileName,
+            std::string const & header,
+            std::vector< float_X > const & table
+        )
+        {
+            boost::filesystem::path const path( fileName );
+            boost::system::error_code error;
+            boost::filesystem::create_directories( path.parent_path(), error );
+
+            boost::filesystem::path const tmpPath = boost::filesystem::unique_path( path.string() + ".%%%%-%%%%" );
+            {
+                std::ofstream file( tmpPath.string().c_str(), std::ios::binary );
+                file.write( header.data(), header.size() );
+                file.write( reinterpret_cast< char const * >( table.data() ), table.size() * sizeof( float_X ) );
+                if( !file )
+                {
+                    log< picLog::PHYSICS >( "lookup table cache file %1% can not be written" ) % fileName;
+                    boost::filesystem::remove( tmpPath, error );
+                    return;
+                }
+            }
+
+            boost::filesystem::rename( tmpPath, path, error );
+            if( error )
+            {
+                log< picLog::PHYSICS >( "lookup table cache file %1% can not be written" ) % fileName;
+                boost::filesystem::remove( tmpPath, error );
+            }
+        }
+
+        std::string m_directory;
+    };
+
+} // namespace particles
+} // namespace picongpu
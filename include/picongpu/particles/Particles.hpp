@@ -33,6 +33,7 @@
 #include <pmacc/particles/ParticleDescription.hpp>
 #include <pmacc/particles/ParticlesBase.hpp>
 #include <pmacc/particles/memory/buffers/ParticlesBuffer.hpp>
+#include <pmacc/particles/memory/HostFrameHeap.hpp>
 #include <pmacc/compileTime/GetKeyFromAlias.hpp>
 #include <pmacc/HandleGuardRegion.hpp>
 #include <pmacc/traits/Resolve.hpp>
@@ -50,18 +51,10 @@ namespace picongpu
 using namespace pmacc;
 
 #if( PMACC_CUDA_ENABLED != 1 )
-/* dummy because we are not using mallocMC with cupla
- * DeviceHeap is defined in `mallocMC.param`
+/* frames of CPU accelerators are allocated in host memory
+ * for CUDA the DeviceHeap is defined in `mallocMC.param`
  */
-struct DeviceHeap
-{
-    using AllocatorHandle = int;
-
-    int getAllocatorHandle()
-    {
-        return 0;
-    }
-};
+using DeviceHeap = pmacc::HostFrameHeap;
 #endif
 
 /** particle species
@@ -148,6 +141,20 @@ public:
 
     void createParticleBuffer();
 
+    /** device memory all exchange stacks can take in addition to their initial size
+     *
+     * @return bytes, see exchangeGrowthLimit in memory.param
+     */
+    size_t getMaxExchangeGrowth() const
+    {
+        return m_maxExchangeGrowth;
+    }
+
+    /** push all particles and mark particles leaving their supercell
+     *
+     * If HasFusedCurrent is true for the species the push also deposits the
+     * current into FieldJ, which must be zeroed before.
+     */
     void update( uint32_t const currentStep );
 
     template<typename T_DensityFunctor, typename T_PositionFunctor>
@@ -222,8 +229,18 @@ public:
     }
 
 private:
+
+    //! push without current deposition
+    void push( uint32_t const currentStep, bmpl::false_ );
+
+    //! push and deposit the current in the same kernel
+    void push( uint32_t const currentStep, bmpl::true_ );
+
     SimulationDataId m_datasetID;
 
+    //! bytes the exchange stacks can grow beyond their initial size
+    size_t m_maxExchangeGrowth;
+
     FieldE *fieldE;
     FieldB *fieldB;
 };
@@ -31,6 +31,8 @@
 
 #include "picongpu/fields/FieldB.hpp"
 #include "picongpu/fields/FieldE.hpp"
+#include "picongpu/fields/FieldJ.hpp"
+#include "picongpu/fields/FieldJ.kernel"
 
 #include <pmacc/particles/memory/buffers/ParticlesBuffer.hpp>
 #include "picongpu/particles/ParticlesInit.kernel"
@@ -40,6 +42,11 @@
 
 #include "picongpu/fields/numericalCellTypes/YeeCell.hpp"
 #include "picongpu/particles/traits/GetMarginPusher.hpp"
+#include "picongpu/particles/traits/GetCurrentSolver.hpp"
+#include "picongpu/particles/traits/HasFusedCurrent.hpp"
+#include "picongpu/algorithms/Velocity.hpp"
+#include "picongpu/traits/GetMargin.hpp"
+#include <pmacc/mappings/kernel/StrideMapping.hpp>
 
 #include <pmacc/traits/GetUniqueTypeId.hpp>
 #include <pmacc/traits/Resolve.hpp>
@@ -78,7 +85,8 @@ Particles<
         heap,
         cellDescription
     ),
-    m_datasetID( datasetID )
+    m_datasetID( datasetID ),
+    m_maxExchangeGrowth( 0u )
 {
     using ExchangeMemCfg = GetExchangeMemCfg_t< Particles >;
 
@@ -87,51 +95,66 @@ Particles<
     const uint32_t commTag = pmacc::traits::GetUniqueTypeId<FrameType, uint32_t>::uid() + SPECIES_FIRSTTAG;
     log<picLog::MEMORY > ( "communication tag for species %1%: %2%" ) % FrameType::getName( ) % commTag;
 
-    this->particlesBuffer->addExchange( Mask( LEFT ) + Mask( RIGHT ),
-                                        ExchangeMemCfg::BYTES_EXCHANGE_X,
-                                        commTag);
+    /* the sizes of the exchange configuration are the initial sizes,
+     * the stacks adapt their size between time steps (see memory.param)
+     */
+    auto addAdaptiveExchange = [ this ]( Mask const & receive, size_t const usedMemory, uint32_t const communicationTag )
+    {
+        this->particlesBuffer->addExchange(
+            receive,
+            usedMemory,
+            communicationTag,
+            usedMemory / exchangeShrinkLimit,
+            usedMemory * exchangeGrowthLimit,
+            exchangeWindowLength
+        );
+    };
+
+    addAdaptiveExchange( Mask( LEFT ) + Mask( RIGHT ),
+                         ExchangeMemCfg::BYTES_EXCHANGE_X,
+                         commTag);
     sizeOfExchanges += ExchangeMemCfg::BYTES_EXCHANGE_X * 2u;
 
-    this->particlesBuffer->addExchange( Mask( TOP ) + Mask( BOTTOM ),
-                                        ExchangeMemCfg::BYTES_EXCHANGE_Y,
-                                        commTag);
+    addAdaptiveExchange( Mask( TOP ) + Mask( BOTTOM ),
+                         ExchangeMemCfg::BYTES_EXCHANGE_Y,
+                         commTag);
     sizeOfExchanges += ExchangeMemCfg::BYTES_EXCHANGE_Y * 2u;
 
     //edges of the simulation area
-    this->particlesBuffer->addExchange( Mask( RIGHT + TOP ) + Mask( LEFT + TOP ) +
-                                        Mask( LEFT + BOTTOM ) + Mask( RIGHT + BOTTOM ), ExchangeMemCfg::BYTES_EDGES,
-                                        commTag);
+    addAdaptiveExchange( Mask( RIGHT + TOP ) + Mask( LEFT + TOP ) +
+                         Mask( LEFT + BOTTOM ) + Mask( RIGHT + BOTTOM ), ExchangeMemCfg::BYTES_EDGES,
+                         commTag);
     sizeOfExchanges += ExchangeMemCfg::BYTES_EDGES * 4u;
 
 #if(SIMDIM==DIM3)
-    this->particlesBuffer->addExchange( Mask( FRONT ) + Mask( BACK ), ExchangeMemCfg::BYTES_EXCHANGE_Z,
-                                        commTag);
+    addAdaptiveExchange( Mask( FRONT ) + Mask( BACK ), ExchangeMemCfg::BYTES_EXCHANGE_Z,
+                         commTag);
     sizeOfExchanges += ExchangeMemCfg::BYTES_EXCHANGE_Z * 2u;
 
     //edges of the simulation area
-    this->particlesBuffer->addExchange( Mask( FRONT + TOP ) + Mask( BACK + TOP ) +
-                                        Mask( FRONT + BOTTOM ) + Mask( BACK + BOTTOM ),
-                                        ExchangeMemCfg::BYTES_EDGES,
-                                        commTag);
+    addAdaptiveExchange( Mask( FRONT + TOP ) + Mask( BACK + TOP ) +
+                         Mask( FRONT + BOTTOM ) + Mask( BACK + BOTTOM ),
+                         ExchangeMemCfg::BYTES_EDGES,
+                         commTag);
     sizeOfExchanges += ExchangeMemCfg::BYTES_EDGES * 4u;
 
-    this->particlesBuffer->addExchange( Mask( FRONT + RIGHT ) + Mask( BACK + RIGHT ) +
-                                        Mask( FRONT + LEFT ) + Mask( BACK + LEFT ),
-                                        ExchangeMemCfg::BYTES_EDGES,
-                                        commTag);
+    addAdaptiveExchange( Mask( FRONT + RIGHT ) + Mask( BACK + RIGHT ) +
+                         Mask( FRONT + LEFT ) + Mask( BACK + LEFT ),
+                         ExchangeMemCfg::BYTES_EDGES,
+                         commTag);
     sizeOfExchanges += ExchangeMemCfg::BYTES_EDGES * 4u;
 
     //corner of the simulation area
-    this->particlesBuffer->addExchange( Mask( TOP + FRONT + RIGHT ) + Mask( TOP + BACK + RIGHT ) +
-                                        Mask( BOTTOM + FRONT + RIGHT ) + Mask( BOTTOM + BACK + RIGHT ),
-                                        ExchangeMemCfg::BYTES_CORNER,
-                                        commTag);
+    addAdaptiveExchange( Mask( TOP + FRONT + RIGHT ) + Mask( TOP + BACK + RIGHT ) +
+                         Mask( BOTTOM + FRONT + RIGHT ) + Mask( BOTTOM + BACK + RIGHT ),
+                         ExchangeMemCfg::BYTES_CORNER,
+                         commTag);
     sizeOfExchanges += ExchangeMemCfg::BYTES_CORNER * 4u;
 
-    this->particlesBuffer->addExchange( Mask( TOP + FRONT + LEFT ) + Mask( TOP + BACK + LEFT ) +
-                                        Mask( BOTTOM + FRONT + LEFT ) + Mask( BOTTOM + BACK + LEFT ),
-                                        ExchangeMemCfg::BYTES_CORNER,
-                                        commTag);
+    addAdaptiveExchange( Mask( TOP + FRONT + LEFT ) + Mask( TOP + BACK + LEFT ) +
+                         Mask( BOTTOM + FRONT + LEFT ) + Mask( BOTTOM + BACK + LEFT ),
+                         ExchangeMemCfg::BYTES_CORNER,
+                         commTag);
     sizeOfExchanges += ExchangeMemCfg::BYTES_CORNER * 4u;
 #endif
 
@@ -142,9 +165,17 @@ Particles<
 
     constexpr size_t byteToMiB = 1024u * 1024u;
 
-    log< picLog::MEMORY >( "size for all exchange of species %1% = %2% MiB" ) %
+    log< picLog::MEMORY >( "initial size for all exchange of species %1% = %2% MiB" ) %
         FrameType::getName( ) %
         ( static_cast< float_64 >( sizeOfExchanges ) / static_cast< float_64 >( byteToMiB ) );
+
+    // growing is taken from the device memory outside of the particle heap
+    m_maxExchangeGrowth = exchangeGrowthLimit > 1u ?
+        sizeOfExchanges * ( exchangeGrowthLimit - 1u ) :
+        0u;
+    log< picLog::MEMORY >( "maximum growth for all exchange of species %1% = %2% MiB" ) %
+        FrameType::getName( ) %
+        ( static_cast< float_64 >( m_maxExchangeGrowth ) / static_cast< float_64 >( byteToMiB ) );
 }
 
 template<
@@ -218,6 +249,26 @@ Particles<
     T_Flags,
     T_Attributes
 >::update( uint32_t const currentStep )
+{
+    push(
+        currentStep,
+        typename particles::traits::HasFusedCurrent< Particles >::type{ }
+    );
+
+    ParticlesBaseType::template shiftParticles < CORE + BORDER > ( );
+}
+
+template<
+    typename T_Name,
+    typename T_Flags,
+    typename T_Attributes
+>
+void
+Particles<
+    T_Name,
+    T_Flags,
+    T_Attributes
+>::push( uint32_t const currentStep, bmpl::false_ )
 {
     using PusherAlias = typename GetFlagType<FrameType,particlePusher<> >::type;
     using ParticlePush = typename pmacc::traits::Resolve<PusherAlias>::type;
@@ -278,10 +329,149 @@ Particles<
 
     dc.releaseData( FieldE::getName() );
     dc.releaseData( FieldB::getName() );
+}
 
-    ParticlesBaseType::template shiftParticles < CORE + BORDER > ( );
+template<
+    typename T_Name,
+    typename T_Flags,
+    typename T_Attributes
+>
+void
+Particles<
+    T_Name,
+    T_Flags,
+    T_Attributes
+>::push( uint32_t const currentStep, bmpl::true_ )
+{
+    using PusherAlias = typename GetFlagType<FrameType,particlePusher<> >::type;
+    using ParticlePush = typename pmacc::traits::Resolve<PusherAlias>::type;
+
+    using InterpolationScheme = typename pmacc::traits::Resolve<
+        typename GetFlagType<
+            FrameType,
+            interpolation< >
+        >::type
+    >::type;
+
+    using FrameSolver = PushParticlePerFrame<
+        ParticlePush,
+        MappingDesc::SuperCellSize,
+        InterpolationScheme
+    >;
+
+    using ParticleCurrentSolver = typename traits::GetCurrentSolver< Particles >::type;
+    using CurrentFrameSolver = ComputeCurrentPerFrame<
+        ParticleCurrentSolver,
+        Velocity,
+        MappingDesc::SuperCellSize
+    >;
+
+    DataConnector & dc = Environment< >::get( ).DataConnector( );
+    auto fieldE = dc.get< FieldE >(
+        FieldE::getName(),
+        true
+    );
+    auto fieldB = dc.get< FieldB >(
+        FieldB::getName(),
+        true
+    );
+    auto fieldJ = dc.get< FieldJ >(
+        FieldJ::getName(),
+        true
+    );
+
+    // adjust interpolation area in particle pusher to allow sub-sampling pushes
+    using LowerMargin = typename GetLowerMarginPusher< Particles >::type;
+    using UpperMargin = typename GetUpperMarginPusher< Particles >::type;
+
+    using BlockArea = SuperCellDescription<
+        typename MappingDesc::SuperCellSize,
+        LowerMargin,
+        UpperMargin
+    >;
+
+    /* The current is deposited relative to the supercell before the push.
+     * A particle can move up to one cell out of the supercell, therefore
+     * the cached current needs one additional cell on each side.
+     */
+    using OneCell = typename pmacc::math::CT::make_Int<
+        simDim,
+        1
+    >::type;
+    using CurrentLowerMargin = typename pmacc::math::CT::add<
+        typename GetMargin< ParticleCurrentSolver >::LowerMargin,
+        OneCell
+    >::type;
+    using CurrentUpperMargin = typename pmacc::math::CT::add<
+        typename GetMargin< ParticleCurrentSolver >::UpperMargin,
+        OneCell
+    >::type;
+    using CurrentBlockArea = SuperCellDescription<
+        typename MappingDesc::SuperCellSize,
+        CurrentLowerMargin,
+        CurrentUpperMargin
+    >;
+
+    using GuardCells = typename pmacc::math::CT::mul<
+        SuperCellSize,
+        GuardSize
+    >::type;
+    PMACC_CASSERT_MSG(
+        _fused_current_deposition_needs_a_larger_guard_or_supercell,
+        pmacc::math::CT::max<
+            typename pmacc::math::CT::max<
+                CurrentLowerMargin,
+                CurrentUpperMargin
+            >::type
+        >::type::value <=
+        pmacc::math::CT::min< GuardCells >::type::value
+    );
+
+    /* Supercells processed in the same kernel call must not write to the
+     * same cells, see FieldJ::computeCurrent()
+     */
+    using MarginPerDim = typename pmacc::math::CT::add<
+        CurrentLowerMargin,
+        CurrentUpperMargin
+    >::type;
+    using MaxMargin = typename pmacc::math::CT::max< MarginPerDim >::type;
+    using SuperCellMinSize = typename pmacc::math::CT::min< SuperCellSize >::type;
+
+    constexpr uint32_t skipSuperCells = ( MaxMargin::value + SuperCellMinSize::value - 1u ) / SuperCellMinSize::value;
+    StrideMapping<
+        CORE + BORDER,
+        skipSuperCells + 1u, // stride 1u means each supercell is used
+        picongpu::MappingDesc
+    > mapper( this->cellDescription );
+
+    constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+        pmacc::math::CT::volume< SuperCellSize >::type::value
+    >::value;
+
+    do
+    {
+        PMACC_KERNEL( KernelMoveAndMarkParticles< numWorkers, BlockArea, CurrentBlockArea >{ } )(
+            mapper.getGridDim(),
+            numWorkers
+        )(
+            this->getDeviceParticlesBox( ),
+            fieldE->getDeviceDataBox( ),
+            fieldB->getDeviceDataBox( ),
+            fieldJ->getDeviceDataBox( ),
+            currentStep,
+            FrameSolver( ),
+            CurrentFrameSolver( DELTA_T ),
+            mapper
+        );
+    }
+    while( mapper.next( ) );
+
+    dc.releaseData( FieldE::getName() );
+    dc.releaseData( FieldB::getName() );
+    dc.releaseData( FieldJ::getName() );
 }
 
+
 template<
     typename T_Name,
     typename T_Flags,
@@ -27,6 +27,7 @@
 
 #include <pmacc/Environment.hpp>
 #include <pmacc/communication/AsyncCommunication.hpp>
+#include <pmacc/simulationControl/PhaseTimer.hpp>
 #include <pmacc/particles/compileTime/FindByNameOrType.hpp>
 
 #include "picongpu/particles/traits/GetIonizerList.hpp"
@@ -132,6 +133,14 @@ struct LogMemoryStatisticsForSpecies
             deviceHeap->getAvailableSlots(sizeof (FrameType)) %
             sizeof (FrameType) %
             FrameType::getName();
+#else
+        log<picLog::MEMORY >("frame heap: free slots for species %3%: %1% a %2%, high-water %4% frames (heap high-water %5% of %6% MiB)") %
+            deviceHeap->getAvailableSlots(sizeof (FrameType)) %
+            sizeof (FrameType) %
+            FrameType::getName() %
+            deviceHeap->getHighWaterSlots(sizeof (FrameType)) %
+            (deviceHeap->getHighWaterBytes() / 1024 / 1024) %
+            (deviceHeap->getCapacity() / 1024 / 1024);
 #endif
     }
 };
@@ -158,6 +167,79 @@ struct CallReset
     }
 };
 
+/** agree on the adaptive particle exchange stack sizes of the given species
+ *
+ * All ranks continue with the largest capacity any rank uses for a
+ * direction, so a send stack and the receive stack of the new neighbor
+ * are equal again after the neighbors changed. Must be called by all
+ * ranks together.
+ *
+ * @tparam T_SpeciesType type or name as boost::mpl::string of the species
+ */
+template< typename T_SpeciesType >
+struct CallAgreeExchangeSizes
+{
+    using SpeciesType = pmacc::particles::compileTime::FindByNameOrType_t<
+        VectorAllSpecies,
+        T_SpeciesType
+    >;
+    using FrameType = typename SpeciesType::FrameType;
+
+    HINLINE void operator()( )
+    {
+        DataConnector &dc = Environment<>::get().DataConnector();
+        auto species = dc.get< SpeciesType >( FrameType::getName(), true );
+        auto & particlesBuffer = species->getParticlesBuffer();
+
+        unsigned long long localCapacities[ 27 ] = { };
+        for( uint32_t ex = 1u; ex < 27u; ++ex )
+            localCapacities[ ex ] = particlesBuffer.getExchangeCapacity( ex );
+
+        unsigned long long globalCapacities[ 27 ];
+        MPI_CHECK( MPI_Allreduce(
+            localCapacities,
+            globalCapacities,
+            27,
+            MPI_UNSIGNED_LONG_LONG,
+            MPI_MAX,
+            Environment< simDim >::get().GridController().getCommunicator().getMPIComm()
+        ) );
+
+        size_t capacities[ 27 ];
+        for( uint32_t ex = 0u; ex < 27u; ++ex )
+            capacities[ ex ] = static_cast< size_t >( globalCapacities[ ex ] );
+        particlesBuffer.restartExchangeSizes( capacities );
+
+        dc.releaseData( FrameType::getName() );
+    }
+};
+
+/** add the maximum growth of the exchange stacks of a species
+ *
+ * @tparam T_SpeciesType type or name as boost::mpl::string of the species
+ */
+template< typename T_SpeciesType >
+struct AddMaxExchangeGrowth
+{
+    using SpeciesType = pmacc::particles::compileTime::FindByNameOrType_t<
+        VectorAllSpecies,
+        T_SpeciesType
+    >;
+    using FrameType = typename SpeciesType::FrameType;
+
+    /** functor
+     *
+     * @param maxExchangeGrowth bytes, the growth of the species is added
+     */
+    HINLINE void operator()( size_t & maxExchangeGrowth ) const
+    {
+        DataConnector &dc = Environment<>::get().DataConnector();
+        auto species = dc.get< SpeciesType >( FrameType::getName(), true );
+        maxExchangeGrowth += species->getMaxExchangeGrowth();
+        dc.releaseData( FrameType::getName() );
+    }
+};
+
 /** Allocate helper fields for FLYlite population kinetics for atomic physics
  *
  * energy histograms, rate matrix, etc.
@@ -245,6 +327,7 @@ struct PushSpecies
         DataConnector &dc = Environment<>::get().DataConnector();
         auto species = dc.get< SpeciesType >( FrameType::getName(), true );
 
+        PhaseTimer::Scope phase( std::string( "push_" ) + FrameType::getName() );
         __startTransaction(eventInt);
         species->update(currentStep);
         dc.releaseData( FrameType::getName() );
@@ -253,6 +336,28 @@ struct PushSpecies
     }
 };
 
+/** sort the particles of a species by their cell
+ *
+ * @tparam T_SpeciesType type or name as boost::mpl::string of particle species that is sorted
+ */
+template<typename T_SpeciesType>
+struct SortSpecies
+{
+    using SpeciesType = pmacc::particles::compileTime::FindByNameOrType_t<
+        VectorAllSpecies,
+        T_SpeciesType
+    >;
+    using FrameType = typename SpeciesType::FrameType;
+
+    HINLINE void operator()() const
+    {
+        DataConnector &dc = Environment<>::get().DataConnector();
+        auto species = dc.get< SpeciesType >( FrameType::getName(), true );
+        species->template sortParticlesByCell< CORE + BORDER >();
+        dc.releaseData( FrameType::getName() );
+    }
+};
+
 /** Communicate a species
  *
  * communication is only triggered for species with a pusher
@@ -324,6 +429,7 @@ struct PushAllSpecies
         }
 
         /* call communication for all species */
+        PhaseTimer::Scope phase( "particleCommunication" );
         ForEach< VectorSpeciesWithPusher, particles::CommunicateSpecies< bmpl::_1> > communicateSpecies;
         communicateSpecies( forward(updateEventList), forward(commEventList) );
 
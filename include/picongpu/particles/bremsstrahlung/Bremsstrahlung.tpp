@@ -286,12 +286,14 @@ void Bremsstrahlung<T_IonSpecies, T_ElectronSpecies, T_PhotonSpecies>::operator(
             boost::mpl::vector<
                 multiMask,
                 momentum,
-                weighting
+                weighting,
+                // assigned by the particle creation kernel
+                particleId
             >
         >(photon);
 
     namespace parOp = pmacc::particles::operations;
-    parOp::assign( destPhoton, parOp::deselect<particleId>(electron) );
+    parOp::assign( destPhoton, electron );
 
     const float3_X elMom = electron[momentum_];
     const float_X weighting = electron[weighting_] / photon::WEIGHTING_RATIO;
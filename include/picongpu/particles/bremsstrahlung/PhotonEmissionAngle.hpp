@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include "picongpu/particles/LookupTableCache.hpp"
 #include <pmacc/cuSTL/container/HostBuffer.hpp>
 #include <pmacc/cuSTL/cursor/Cursor.hpp>
 #include <pmacc/cuSTL/cursor/navigator/PlusNavigator.hpp>
@@ -235,21 +236,43 @@ public:
         const float_64 lnMinGamma = math::log(photon::MIN_GAMMA);
         const float_64 lnMaxGamma = math::log(photon::MAX_GAMMA);
 
-        for(uint32_t gammaIdx = 0; gammaIdx < photon::NUM_SAMPLES_GAMMA; gammaIdx++)
-        {
-            const float_64 lnGamma_norm = static_cast<float_64>(gammaIdx) /
-                                          static_cast<float_64>(photon::NUM_SAMPLES_GAMMA - 1);
-            const float_64 gamma = math::exp(lnMinGamma + (lnMaxGamma - lnMinGamma) * lnGamma_norm);
-            const float_64 maxTheta = this->maxTheta(gamma);
-
-            for(uint32_t deltaIdx = 0; deltaIdx < photon::NUM_SAMPLES_DELTA; deltaIdx++)
+        /* all values the table depends on, the version must be increased
+         * if the computation of the table changes
+         */
+        std::stringstream key = LookupTableCache::createKey("bremsstrahlungPhotonAngle");
+        key << " version=1"
+            << " numSamplesDelta=" << photon::NUM_SAMPLES_DELTA
+            << " numSamplesGamma=" << photon::NUM_SAMPLES_GAMMA
+            << " maxDelta=" << photon::MAX_DELTA
+            << " minGamma=" << photon::MIN_GAMMA
+            << " maxGamma=" << photon::MAX_GAMMA;
+
+        // an entry holds theta of all deltas for one gamma
+        std::vector<float_X> const table = LookupTableCache::getInstance().getTable(
+            "bremsstrahlungPhotonAngle",
+            key.str(),
+            photon::NUM_SAMPLES_GAMMA,
+            photon::NUM_SAMPLES_DELTA,
+            [&](const uint32_t gammaIdx, float_X* values)
             {
-                const float_64 delta = photon::MAX_DELTA * static_cast<float_64>(deltaIdx) /
-                                       static_cast<float_64>(photon::NUM_SAMPLES_DELTA - 1);
-
-                *curTheta(deltaIdx, gammaIdx) = static_cast<float_X>(this->theta(delta, gamma, maxTheta));
+                const float_64 lnGamma_norm = static_cast<float_64>(gammaIdx) /
+                                              static_cast<float_64>(photon::NUM_SAMPLES_GAMMA - 1);
+                const float_64 gamma = math::exp(lnMinGamma + (lnMaxGamma - lnMinGamma) * lnGamma_norm);
+                const float_64 maxTheta = this->maxTheta(gamma);
+
+                for(uint32_t deltaIdx = 0; deltaIdx < photon::NUM_SAMPLES_DELTA; deltaIdx++)
+                {
+                    const float_64 delta = photon::MAX_DELTA * static_cast<float_64>(deltaIdx) /
+                                           static_cast<float_64>(photon::NUM_SAMPLES_DELTA - 1);
+
+                    values[deltaIdx] = static_cast<float_X>(this->theta(delta, gamma, maxTheta));
+                }
             }
-        }
+        );
+
+        for(uint32_t gammaIdx = 0; gammaIdx < photon::NUM_SAMPLES_GAMMA; gammaIdx++)
+            for(uint32_t deltaIdx = 0; deltaIdx < photon::NUM_SAMPLES_DELTA; deltaIdx++)
+                *curTheta(deltaIdx, gammaIdx) = table[gammaIdx * photon::NUM_SAMPLES_DELTA + deltaIdx];
 
         *this->dBufTheta = hBufTheta;
     }
@@ -18,6 +18,7 @@
  */
 
 #include "picongpu/simulation_defines.hpp"
+#include "picongpu/particles/LookupTableCache.hpp"
 #include <pmacc/algorithms/math/defines/pi.hpp>
 #include <pmacc/cuSTL/container/HostBuffer.hpp>
 
@@ -147,20 +148,50 @@ void ScaledSpectrum::init(const float_64 targetZ)
 
     typedef boost::array<float_64, 1> state_type;
 
-    for(uint32_t EkinIdx = 0; EkinIdx < electron::NUM_SAMPLES_EKIN; EkinIdx++)
+    // sample points of the table
+    auto const getKappa = [](const uint32_t kappaIdx)
     {
-        for(uint32_t kappaIdx = 0; kappaIdx < electron::NUM_SAMPLES_KAPPA; kappaIdx++)
+        const float_64 kappa = static_cast<float_64>(kappaIdx) /
+                               static_cast<float_64>(electron::NUM_SAMPLES_KAPPA - 1);
+        return kappa == 0.0 ? electron::MIN_KAPPA : kappa;
+    };
+    auto const getEkin = [lnEMin, lnEMax](const uint32_t EkinIdx)
+    {
+        const float_64 lnE_norm = static_cast<float_64>(EkinIdx) /
+                                  static_cast<float_64>(electron::NUM_SAMPLES_EKIN - 1);
+        return math::exp(lnEMin + (lnEMax - lnEMin) * lnE_norm);
+    };
+
+    /* all values the table depends on, the version must be increased
+     * if the computation of the table changes
+     */
+    std::stringstream key = LookupTableCache::createKey("bremsstrahlungScaledSpectrum");
+    key << " version=1"
+        << " targetZ=" << targetZ
+        << " minEnergy=" << float_64(electron::MIN_ENERGY)
+        << " maxEnergy=" << float_64(electron::MAX_ENERGY)
+        << " numSamplesEkin=" << electron::NUM_SAMPLES_EKIN
+        << " numSamplesKappa=" << electron::NUM_SAMPLES_KAPPA
+        << " minKappa=" << electron::MIN_KAPPA
+        << " numStepsStoppingPowerIntegral=" << float_64(electron::NUM_STEPS_STOPPING_POWER_INTERGRAL)
+        << " eps0=" << float_64(EPS0)
+        << " hbar=" << float_64(HBAR)
+        << " electronMass=" << float_64(ELECTRON_MASS)
+        << " electronCharge=" << float_64(ELECTRON_CHARGE)
+        << " speedOfLight=" << float_64(SPEED_OF_LIGHT);
+
+    // an entry holds the scaled spectrum and the stopping power of an (Ekin, kappa) pair
+    std::vector<float_X> const table = LookupTableCache::getInstance().getTable(
+        "bremsstrahlungScaledSpectrum",
+        key.str(),
+        electron::NUM_SAMPLES_EKIN * electron::NUM_SAMPLES_KAPPA,
+        2u,
+        [&](const uint32_t entryIdx, float_X* values)
         {
-            float_64 kappa = static_cast<float_64>(kappaIdx) /
-                             static_cast<float_64>(electron::NUM_SAMPLES_KAPPA - 1);
-            if(kappa == 0.0)
-                kappa = electron::MIN_KAPPA;
+            const float_64 kappa = getKappa(entryIdx % electron::NUM_SAMPLES_KAPPA);
+            const float_64 Ekin = getEkin(entryIdx / electron::NUM_SAMPLES_KAPPA);
 
-            const float_64 lnE_norm = static_cast<float_64>(EkinIdx) /
-                                      static_cast<float_64>(electron::NUM_SAMPLES_EKIN - 1);
-            const float_64 Ekin = math::exp(lnEMin + (lnEMax - lnEMin) * lnE_norm);
-
-            *curScaledSpectrum(EkinIdx, kappaIdx) = Ekin * kappa * static_cast<float_X>(this->dcs(Ekin, kappa, targetZ));
+            values[0] = Ekin * kappa * static_cast<float_X>(this->dcs(Ekin, kappa, targetZ));
 
             state_type integral_result = {0.0};
             const float_64 lowerLimit = electron::MIN_KAPPA * Ekin;
@@ -168,7 +199,20 @@ void ScaledSpectrum::init(const float_64 targetZ)
             const float_64 stepwidth = upperLimit / electron::NUM_STEPS_STOPPING_POWER_INTERGRAL;
             StoppingPowerIntegrand integrand(Ekin, *this, targetZ);
             odeint::integrate(integrand, integral_result, lowerLimit, upperLimit, stepwidth);
-            *curStoppingPower(EkinIdx, kappaIdx) = static_cast<float_X>(integral_result[0]);
+            values[1] = static_cast<float_X>(integral_result[0]);
+        }
+    );
+
+    for(uint32_t EkinIdx = 0; EkinIdx < electron::NUM_SAMPLES_EKIN; EkinIdx++)
+    {
+        for(uint32_t kappaIdx = 0; kappaIdx < electron::NUM_SAMPLES_KAPPA; kappaIdx++)
+        {
+            const uint32_t entryIdx = EkinIdx * electron::NUM_SAMPLES_KAPPA + kappaIdx;
+            *curScaledSpectrum(EkinIdx, kappaIdx) = table[2u * entryIdx];
+            *curStoppingPower(EkinIdx, kappaIdx) = table[2u * entryIdx + 1u];
+
+            const float_64 kappa = getKappa(kappaIdx);
+            const float_64 Ekin = getEkin(EkinIdx);
 
             // check for nans
             if(*curScaledSpectrum(EkinIdx, kappaIdx) != *curScaledSpectrum(EkinIdx, kappaIdx))
@@ -44,6 +44,9 @@ namespace creation
  *
  * `particleCreator` must define: `init()`, `numNewParticles()` and `operator()()`
  * \see `PhotonCreator.hpp` for a further description.
+ *
+ * The attribute `particleId` of the created particles is assigned by the kernel,
+ * `operator()()` should exclude it from the target particle.
  */
 template<typename T_SourceSpecies, typename T_TargetSpecies, typename T_ParticleCreator, typename T_CellDescription>
 void createParticlesFromSpecies(T_SourceSpecies& sourceSpecies,
@@ -25,11 +25,14 @@
 
 #include <pmacc/static_assert.hpp>
 #include <pmacc/memory/buffers/GridBuffer.hpp>
-#include <pmacc/memory/boxes/DataBoxDim1Access.hpp>
 #include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/dimensions/DataSpaceOperations.hpp>
 
 #include <splash/splash.h>
 
+#include <algorithm>
+#include <vector>
+
 
 namespace picongpu
 {
@@ -70,23 +73,40 @@ struct FromHDF5Impl : public T_ParamClass
 
 private:
 
-    void loadHDF5(Window &window)
+    typedef typename FieldTmp::ValueType::type ValueType;
+
+    /** host copy of the file data this rank needs during the whole simulation
+     *
+     * The moving window slides in y direction only, therefore the cache holds
+     * the part of the file covered by the local domain in x and z and the whole
+     * file in y. The file is read once, each slide copies its slab from the cache.
+     */
+    struct Cache
     {
-        using namespace splash;
-        DataConnector &dc = Environment<>::get().DataConnector();
+        bool isLoaded = false;
+        //! offset of the first cached value in the simulation [in cells]
+        DataSpace<simDim> offset;
+        //! number of cached values per dimension
+        DataSpace<simDim> size;
+        std::vector<ValueType> data;
+    };
 
-        PMACC_CASSERT_MSG(
-            _please_allocate_at_least_one_FieldTmp_in_memory_param,
-            fieldTmpNumSlots > 0
-        );
-        auto fieldTmp = dc.get< FieldTmp >( FieldTmp::getUniqueId( 0 ), true );
-        auto& fieldBuffer = fieldTmp->getGridBuffer();
+    static Cache& getCache()
+    {
+        static Cache cache;
+        return cache;
+    }
 
-        deviceDataBox = fieldBuffer.getDeviceBuffer().getDataBox();
+    /** read the data of all slides of this rank from the file
+     *
+     * @return false if the file can not be read
+     */
+    bool readCache(Cache& cache)
+    {
+        using namespace splash;
 
         GridController<simDim> &gc = Environment<simDim>::get().GridController();
         const pmacc::Selection<simDim>& localDomain = Environment<simDim>::get().SubGrid().getLocalDomain();
-        const uint32_t numSlides = MovingWindow::getInstance().getSlideCounter(0);
         const uint32_t maxOpenFilesPerNode = 1;
 
         /* get a new ParallelDomainCollector for our MPI rank only*/
@@ -105,90 +125,31 @@ private:
 
             pdc.open(ParamClass::filename, attr);
 
-            /* set which part of the hdf5 file our MPI rank reads */
-            DataSpace<simDim> globalSlideOffset;
-            globalSlideOffset.y() = numSlides * localDomain.size.y();
-
-            Dimensions domainOffset(0, 0, 0);
-            for (uint32_t d = 0; d < simDim; ++d)
-                domainOffset[d] = localDomain.offset[d] + globalSlideOffset[d];
-
-            if (gc.getPosition().y() == 0)
-                domainOffset[1] += window.globalDimensions.offset.y();
-
-            DataSpace<simDim> localDomainSize = localDomain.size;
-            Dimensions domainSize(1, 1, 1);
-            for (uint32_t d = 0; d < simDim; ++d)
-                domainSize[d] = localDomainSize[d];
-
-            /* clear host buffer with default value */
-            fieldBuffer.getHostBuffer().setValue(float1_X(ParamClass::defaultDensity));
-
             /* get dimensions and offsets (collective call) */
             Domain fileDomain = pdc.getGlobalDomain(ParamClass::iteration, ParamClass::datasetName);
-            Dimensions fileDomainEnd = fileDomain.getOffset() + fileDomain.getSize();
-            DataSpace<simDim> accessSpace;
-            DataSpace<simDim> accessOffset;
 
+            /* overlap of the local domain and the file in x and z, the whole file in y */
             Dimensions fileAccessSpace(1, 1, 1);
             Dimensions fileAccessOffset(0, 0, 0);
-
-            /* For each dimension, compute how file domain and local simulation domain overlap
-             * and which sizes and offsets are required for loading data from the file.
-             **/
             for (uint32_t d = 0; d < simDim; ++d)
             {
-                /* file domain in/in-after sim domain */
-                if (fileDomain.getOffset()[d] >= domainOffset[d] &&
-                    fileDomain.getOffset()[d] <= domainOffset[d] + domainSize[d])
+                int begin = fileDomain.getOffset()[d];
+                int end = fileDomain.getOffset()[d] + fileDomain.getSize()[d];
+                if (d != 1)
                 {
-                    accessSpace[d] = std::min(domainOffset[d] + domainSize[d] - fileDomain.getOffset()[d],
-                                              fileDomain.getSize()[d]);
-                    fileAccessSpace[d] = accessSpace[d];
-
-                    accessOffset[d] = fileDomain.getOffset()[d] - domainOffset[d];
-                    fileAccessOffset[d] = 0;
-                    continue;
-                }
-
-                /* file domain before-in sim domain */
-                if (fileDomainEnd[d] >= domainOffset[d] &&
-                    fileDomainEnd[d] <= domainOffset[d] + domainSize[d])
-                {
-                    accessSpace[d] = fileDomainEnd[d] - domainOffset[d];
-                    fileAccessSpace[d] = accessSpace[d];
-
-                    accessOffset[d] = 0;
-                    fileAccessOffset[d] = domainOffset[d] - fileDomain.getOffset()[d];
-                    continue;
+                    begin = std::max(begin, localDomain.offset[d]);
+                    end = std::min(end, localDomain.offset[d] + localDomain.size[d]);
                 }
-
-                /* sim domain in file domain */
-                if (domainOffset[d] >= fileDomain.getOffset()[d] &&
-                    domainOffset[d] + domainSize[d] <= fileDomainEnd[d])
-                {
-                    accessSpace[d] = domainSize[d];
-                    fileAccessSpace[d] = accessSpace[d];
-
-                    accessOffset[d] = 0;
-                    fileAccessOffset[d] = domainOffset[d] - fileDomain.getOffset()[d];
-                    continue;
-                }
-
-                /* file domain and sim domain do not intersect, do not load anything */
-                accessSpace[d] = 0;
-                break;
+                cache.offset[d] = begin;
+                cache.size[d] = std::max(end - begin, 0);
+                fileAccessSpace[d] = cache.size[d];
+                fileAccessOffset[d] = begin - fileDomain.getOffset()[d];
             }
 
-            /* allocate temporary buffer for hdf5 data */
-            typedef typename FieldTmp::ValueType::type ValueType;
-            ValueType *tmpBfr = nullptr;
-
-            size_t accessSize = accessSpace.productOfComponents();
+            const size_t accessSize = cache.size.productOfComponents();
+            cache.data.resize(accessSize);
             if (accessSize > 0)
             {
-                tmpBfr = new ValueType[accessSize];
-
                 Dimensions sizeRead(0, 0, 0);
                 pdc.read(
                          ParamClass::iteration,
@@ -196,44 +157,93 @@ private:
                          fileAccessOffset,
                          ParamClass::datasetName,
                          sizeRead,
-                         tmpBfr);
+                         cache.data.data());
 
                 if (sizeRead.getScalarSize() != accessSize)
                 {
-                    __delete(tmpBfr);
-                    return;
+                    pdc.close();
+                    return false;
                 }
+            }
 
-                /* get the databox of the host buffer */
-                auto dataBox = fieldBuffer.getHostBuffer().getDataBox();
-                /* get a 1D access object to the databox */
-                typedef DataBoxDim1Access< typename FieldTmp::DataBoxType > D1Box;
-                DataSpace<simDim> guards = fieldBuffer.getGridLayout().getGuard();
-                D1Box d1RAccess(dataBox.shift(guards + accessOffset), accessSpace);
+            pdc.close();
+        }
+        catch (const DCException& e)
+        {
+            std::cerr << e.what() << std::endl;
+            return false;
+        }
 
-                /* copy from temporary buffer to fieldTmp host buffer */
-                for (int i = 0; i < accessSpace.productOfComponents(); ++i)
-                {
-                    d1RAccess[i].x() = tmpBfr[i];
-                }
+        log<picLog::INPUT_OUTPUT > ("FromHDF5: cached %1% values of %2%") %
+            cache.data.size() % ParamClass::filename;
+        return true;
+    }
 
-                __delete(tmpBfr);
-            }
+    void loadHDF5(Window &window)
+    {
+        DataConnector &dc = Environment<>::get().DataConnector();
 
-            pdc.close();
+        PMACC_CASSERT_MSG(
+            _please_allocate_at_least_one_FieldTmp_in_memory_param,
+            fieldTmpNumSlots > 0
+        );
+        auto fieldTmp = dc.get< FieldTmp >( FieldTmp::getUniqueId( 0 ), true );
+        auto& fieldBuffer = fieldTmp->getGridBuffer();
 
-            /* copy host data to the device */
-            fieldBuffer.hostToDevice();
-            __getTransactionEvent().waitForFinished();
+        deviceDataBox = fieldBuffer.getDeviceBuffer().getDataBox();
 
+        Cache& cache = getCache();
+        if (!cache.isLoaded)
+        {
+            if (!readCache(cache))
+                return;
+            cache.isLoaded = true;
         }
-        catch (const DCException& e)
+
+        GridController<simDim> &gc = Environment<simDim>::get().GridController();
+        const pmacc::Selection<simDim>& localDomain = Environment<simDim>::get().SubGrid().getLocalDomain();
+        const uint32_t numSlides = MovingWindow::getInstance().getSlideCounter(0);
+
+        /* set which part of the file our MPI rank uses */
+        DataSpace<simDim> domainOffset(localDomain.offset);
+        domainOffset.y() += numSlides * localDomain.size.y();
+        if (gc.getPosition().y() == 0)
+            domainOffset.y() += window.globalDimensions.offset.y();
+
+        /* clear host buffer with default value */
+        fieldBuffer.getHostBuffer().setValue(float1_X(ParamClass::defaultDensity));
+
+        /* overlap of the local domain and the cache */
+        DataSpace<simDim> accessSpace;
+        DataSpace<simDim> accessOffset;
+        for (uint32_t d = 0; d < simDim; ++d)
         {
-            std::cerr << e.what() << std::endl;
-            return;
+            const int begin = std::max(domainOffset[d], cache.offset[d]);
+            const int end = std::min(domainOffset[d] + localDomain.size[d], cache.offset[d] + cache.size[d]);
+            accessSpace[d] = std::max(end - begin, 0);
+            accessOffset[d] = begin - domainOffset[d];
+        }
+
+        if (accessSpace.productOfComponents() > 0)
+        {
+            /* get the databox of the host buffer */
+            auto dataBox = fieldBuffer.getHostBuffer().getDataBox();
+            DataSpace<simDim> guards = fieldBuffer.getGridLayout().getGuard();
+            auto const localBox = dataBox.shift(guards + accessOffset);
+            const DataSpace<simDim> cacheOffset = domainOffset + accessOffset - cache.offset;
+
+            /* copy from the cache to fieldTmp host buffer */
+            for (int i = 0; i < accessSpace.productOfComponents(); ++i)
+            {
+                const DataSpace<simDim> cellIdx = DataSpaceOperations<simDim>::map(accessSpace, i);
+                localBox(cellIdx).x() =
+                    cache.data[DataSpaceOperations<simDim>::map(cache.size, cellIdx + cacheOffset)];
+            }
         }
 
-        return;
+        /* copy host data to the device */
+        fieldBuffer.hostToDevice();
+        __getTransactionEvent().waitForFinished();
     }
 
     PMACC_ALIGN(deviceDataBox,FieldTmp::DataBoxType);
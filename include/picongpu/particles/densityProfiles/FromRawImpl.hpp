@@ -0,0 +1,241 @@
+/* Copyright 2018 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+#include "picongpu/fields/Fields.hpp"
+#include "picongpu/simulationControl/MovingWindow.hpp"
+
+#include <pmacc/static_assert.hpp>
+#include <pmacc/memory/buffers/GridBuffer.hpp>
+#include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/dimensions/DataSpaceOperations.hpp>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+
+namespace picongpu
+{
+namespace densityProfiles
+{
+
+/** density profile from a raw binary grid
+ *
+ * The file contains `sampleCount` 32 bit floating point values of the
+ * normalized density in native byte order, x is the fastest index.
+ * Each sample describes `cellsPerSample` cells per dimension, the density of
+ * a cell is linearly interpolated between the neighboring samples. Cells
+ * outside of the grid get `defaultDensity`.
+ *
+ * The file is memory mapped once, each slide of the moving window reads only
+ * the samples of the new local domain.
+ */
+template<typename T_ParamClass>
+struct FromRawImpl : public T_ParamClass
+{
+    typedef T_ParamClass ParamClass;
+
+    template<typename T_SpeciesType>
+    struct apply
+    {
+        typedef FromRawImpl<ParamClass> type;
+    };
+
+    HINLINE FromRawImpl(uint32_t currentStep)
+    {
+        const uint32_t numSlides = MovingWindow::getInstance( ).getSlideCounter( currentStep );
+        const SubGrid<simDim>& subGrid = Environment<simDim>::get().SubGrid();
+        DataSpace<simDim> localCells = subGrid.getLocalDomain( ).size;
+        totalGpuOffset = subGrid.getLocalDomain( ).offset;
+        totalGpuOffset.y( ) += numSlides * localCells.y( );
+        loadRaw();
+    }
+
+    /** Calculate the normalized density from the raw file
+     *
+     * @param totalCellOffset total offset including all slides [in cells]
+     */
+    HDINLINE float_X operator()(const DataSpace<simDim>& totalCellOffset)
+    {
+        const DataSpace<simDim> localCellIdx(totalCellOffset - totalGpuOffset);
+        return precisionCast<float_X>(deviceDataBox(localCellIdx + SuperCellSize::toRT() * GuardSize::toRT()).x());
+    }
+
+private:
+
+    //! read-only mapping of the whole file, kept until the end of the simulation
+    struct MappedFile
+    {
+        float const* data = nullptr;
+        size_t bytes = 0;
+
+        ~MappedFile()
+        {
+            if (data != nullptr)
+                munmap(const_cast<float*>(data), bytes);
+        }
+    };
+
+    /** map the file once
+     *
+     * @param sampleCount number of samples per dimension
+     */
+    static MappedFile& getFile(DataSpace<simDim> const& sampleCount)
+    {
+        static MappedFile file;
+        if (file.data != nullptr)
+            return file;
+
+        const std::string fileName(ParamClass::filename);
+        const size_t expectedBytes =
+            size_t(sampleCount.productOfComponents()) * sizeof(float);
+
+        const int fd = open(fileName.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::runtime_error(
+                "FromRaw: can not open " + fileName + ": " + std::strerror(errno));
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0 || size_t(fileStat.st_size) != expectedBytes)
+        {
+            close(fd);
+            throw std::runtime_error(
+                "FromRaw: " + fileName + " does not contain " +
+                std::to_string(expectedBytes) + " bytes (sampleCount in density.param)");
+        }
+
+        void* mapped = mmap(nullptr, expectedBytes, PROT_READ, MAP_SHARED, fd, 0);
+        /* the mapping stays valid after the file is closed */
+        close(fd);
+        if (mapped == MAP_FAILED)
+            throw std::runtime_error(
+                "FromRaw: can not map " + fileName + ": " + std::strerror(errno));
+
+        file.data = static_cast<float const*>(mapped);
+        file.bytes = expectedBytes;
+        log<picLog::INPUT_OUTPUT > ("FromRaw: mapped %1% (%2% bytes)") % fileName % expectedBytes;
+        return file;
+    }
+
+    /** interpolate the density of a cell
+     *
+     * @param file mapped file
+     * @param sampleCount number of samples per dimension
+     * @param cellsPerSample number of cells per sample and dimension
+     * @param totalCell cell index relative to the origin of the grid
+     */
+    static float_X interpolate(
+        MappedFile const& file,
+        DataSpace<simDim> const& sampleCount,
+        DataSpace<simDim> const& cellsPerSample,
+        DataSpace<simDim> const& totalCell)
+    {
+        DataSpace<simDim> lower;
+        DataSpace<simDim> upper;
+        floatD_X weight;
+        for (uint32_t d = 0; d < simDim; ++d)
+        {
+            if (totalCell[d] < 0 || totalCell[d] >= sampleCount[d] * cellsPerSample[d])
+                return ParamClass::defaultDensity;
+
+            /* samples are located in the center of the cells they describe */
+            const float_X position =
+                (float_X(totalCell[d]) + float_X(0.5)) / float_X(cellsPerSample[d]) - float_X(0.5);
+            const int sample = int(math::floor(position));
+            lower[d] = std::max(sample, 0);
+            upper[d] = std::min(sample + 1, sampleCount[d] - 1);
+            weight[d] = std::min(std::max(position - float_X(sample), float_X(0.0)), float_X(1.0));
+        }
+
+        float_X density(0.0);
+        for (uint32_t corner = 0; corner < (1u << simDim); ++corner)
+        {
+            DataSpace<simDim> sampleIdx;
+            float_X cornerWeight(1.0);
+            for (uint32_t d = 0; d < simDim; ++d)
+            {
+                const bool isUpper = (corner >> d) & 1u;
+                sampleIdx[d] = isUpper ? upper[d] : lower[d];
+                cornerWeight *= isUpper ? weight[d] : float_X(1.0) - weight[d];
+            }
+            if (cornerWeight != float_X(0.0))
+                density += cornerWeight *
+                    float_X(file.data[DataSpaceOperations<simDim>::map(sampleCount, sampleIdx)]);
+        }
+        return density;
+    }
+
+    void loadRaw()
+    {
+        DataConnector &dc = Environment<>::get().DataConnector();
+
+        PMACC_CASSERT_MSG(
+            _please_allocate_at_least_one_FieldTmp_in_memory_param,
+            fieldTmpNumSlots > 0
+        );
+        auto fieldTmp = dc.get< FieldTmp >( FieldTmp::getUniqueId( 0 ), true );
+        auto& fieldBuffer = fieldTmp->getGridBuffer();
+
+        deviceDataBox = fieldBuffer.getDeviceBuffer().getDataBox();
+
+        DataSpace<simDim> sampleCount;
+        DataSpace<simDim> cellsPerSample;
+        for (uint32_t d = 0; d < simDim; ++d)
+        {
+            sampleCount[d] = this->sampleCount[d];
+            cellsPerSample[d] = this->cellsPerSample[d];
+        }
+
+        MappedFile const& file = getFile(sampleCount);
+        const DataSpace<simDim> localCells = Environment<simDim>::get().SubGrid().getLocalDomain().size;
+
+        auto dataBox = fieldBuffer.getHostBuffer().getDataBox();
+        DataSpace<simDim> guards = fieldBuffer.getGridLayout().getGuard();
+        auto const localBox = dataBox.shift(guards);
+
+        const int numCells = localCells.productOfComponents();
+        #pragma omp parallel for
+        for (int i = 0; i < numCells; ++i)
+        {
+            const DataSpace<simDim> cellIdx = DataSpaceOperations<simDim>::map(localCells, i);
+            localBox(cellIdx).x() = interpolate(file, sampleCount, cellsPerSample, totalGpuOffset + cellIdx);
+        }
+
+        /* copy host data to the device */
+        fieldBuffer.hostToDevice();
+        __getTransactionEvent().waitForFinished();
+
+    }
+
+    PMACC_ALIGN(deviceDataBox,FieldTmp::DataBoxType);
+    PMACC_ALIGN(totalGpuOffset,DataSpace<simDim>);
+};
+}
+}
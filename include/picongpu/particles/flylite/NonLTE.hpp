@@ -57,8 +57,9 @@ namespace flylite
 
         /** Update atomic configurations
          *
-         * Prepares auxiliary fields for the non-LTE atomic physics model and
-         * updates the configurations & charge states of an ion species.
+         * Prepares auxiliary fields for the non-LTE atomic physics model,
+         * assembles the local rate matrices and evolves the local populations
+         * of an ion species implicitly by one time step.
          *
          * @tparam T_IonSpeciesType a picongpu::Particles class with an ion
          *                          species
@@ -78,8 +79,8 @@ namespace flylite
     private:
         /** Calculate new values in helper fields
          *
-         * Prepares helper fields by calculating local densities and energy
-         * histograms.
+         * Prepares helper fields by calculating local densities, populations
+         * and energy histograms.
          *
          * @param ionSpeciesName unique name of the ion species in T_IonSpeciesType
          * @param currentStep the current time step
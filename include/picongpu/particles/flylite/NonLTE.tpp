@@ -22,10 +22,14 @@
 #include "picongpu/particles/flylite/helperFields/LocalEnergyHistogram.hpp"
 #include "picongpu/particles/flylite/helperFields/LocalEnergyHistogramFunctors.hpp"
 #include "picongpu/particles/flylite/helperFields/LocalRateMatrix.hpp"
+#include "picongpu/particles/flylite/helperFields/LocalRateMatrixFunctors.hpp"
+#include "picongpu/particles/flylite/helperFields/LocalPopulations.hpp"
+#include "picongpu/particles/flylite/helperFields/LocalPopulationsFunctors.hpp"
 #include "picongpu/particles/flylite/helperFields/LocalDensity.hpp"
 #include "picongpu/particles/flylite/helperFields/LocalDensityFunctors.hpp"
 #include "picongpu/particles/particleToGrid/derivedAttributes/Density.def"
 #include "picongpu/particles/traits/GetShape.hpp"
+#include "picongpu/particles/flylite/solver/ImplicitRateEquations.hpp"
 
 /* pmacc */
 #include <pmacc/Environment.hpp>
@@ -105,6 +109,16 @@ namespace flylite
                 )
             );
 
+        if( ! dc.hasId( helperFields::LocalPopulations::getName( ionSpeciesName ) ) )
+            dc.share(
+                std::shared_ptr< ISimulationData >(
+                    new helperFields::LocalPopulations(
+                        ionSpeciesName,
+                        m_avgGridSizeLocal
+                    )
+                )
+            );
+
         if( ! dc.hasId( helperFields::LocalDensity::getName( ionSpeciesName ) ) )
             dc.share(
                 std::shared_ptr< ISimulationData >(
@@ -141,8 +155,24 @@ namespace flylite
         // calculate density fields and energy histograms
         fillHelpers< IonSpeciesType >( ionSpeciesName, currentStep );
 
-        //! @todo calculate rate matrix
-        //! @todo implicit ODE solve to evolve populations
+        // calculate rate matrix
+        helperFields::FillLocalRateMatrix fillRateMatrix{};
+        fillRateMatrix(
+            currentStep,
+            ionSpeciesName,
+            "electrons",
+            picongpu::flylite::electronMinEnergy,
+            picongpu::flylite::electronMaxEnergy
+        );
+
+        // implicit ODE solve to evolve populations
+        solver::SolveRateEquations solveRateEquations{};
+        solveRateEquations(
+            currentStep,
+            ionSpeciesName
+        );
+
+        //! @todo write evolved populations back to the superconfig of the ions
         //! @todo modify f_e of free electrons
         //! @todo modify f_ph of photon field (absorb)
         //! @todo change charges, create electrons & photons
@@ -183,6 +213,13 @@ namespace flylite
             "electrons"
         );
 
+        // sum ion superconfigurations to local populations
+        helperFields::FillLocalPopulations< IonSpeciesType > fillPopulations{};
+        fillPopulations(
+            currentStep,
+            ionSpeciesName
+        );
+
         // calculate energy histograms: f(e), f(ph)
         helperFields::FillLocalEnergyHistogram< T_ElectronsList > fillEnergyHistogramElectrons{};
         fillEnergyHistogramElectrons(
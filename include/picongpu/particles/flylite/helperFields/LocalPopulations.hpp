@@ -0,0 +1,121 @@
+/* Copyright 2017-2018 Axel Huebl
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+// pmacc
+#include <pmacc/dataManagement/ISimulationData.hpp>
+#include <pmacc/dimensions/GridLayout.hpp>
+#include <pmacc/memory/buffers/GridBuffer.hpp>
+#include <pmacc/memory/Array.hpp>
+
+#include <string>
+
+
+namespace picongpu
+{
+namespace particles
+{
+namespace flylite
+{
+namespace helperFields
+{
+    using namespace pmacc;
+
+    class LocalPopulations :
+        public ISimulationData
+    {
+    public:
+        /** N[iz, numpop] */
+        using Populations = memory::Array<
+            memory::Array<
+                float_X,
+                picongpu::flylite::populations
+            >,
+            picongpu::flylite::ionizationStates
+        >;
+
+    private:
+        GridBuffer< Populations, simDim >* m_populations;
+        std::string m_speciesName;
+
+    public:
+        /** Allocate and initialize local populations of an ion species
+         *
+         * The populations are the densities of bound electrons in each
+         * population of the superconfiguration, summed separately for each
+         * ionization state.
+         *
+         * @param ionSpeciesName unique name of the ion species
+         * @param sizeLocal spatial size of the local populations
+         */
+        LocalPopulations(
+            std::string const & ionSpeciesName,
+            DataSpace< simDim > const & sizeLocal
+        ) :
+            m_populations( nullptr ),
+            m_speciesName( ionSpeciesName )
+        {
+            // without guards
+            m_populations = new GridBuffer< Populations, simDim >( sizeLocal );
+        }
+
+        ~LocalPopulations()
+        {
+            __delete( m_populations );
+        }
+
+        static std::string
+        getName( std::string const & speciesGroup )
+        {
+            return speciesGroup + "_LocalPopulations";
+        }
+
+        std::string
+        getName( )
+        {
+            return getName( m_speciesName );
+        }
+
+        GridBuffer< Populations, simDim >&
+        getGridBuffer( )
+        {
+            return *m_populations;
+        }
+
+        /* implement ISimulationData members */
+        void
+        synchronize()
+        {
+            m_populations->deviceToHost( );
+        }
+
+        SimulationDataId
+        getUniqueId()
+        {
+            return getName();
+        }
+    };
+
+} // namespace helperFields
+} // namespace flylite
+} // namespace particles
+} // namespace picongpu
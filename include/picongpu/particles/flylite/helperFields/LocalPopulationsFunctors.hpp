@@ -0,0 +1,114 @@
+/* Copyright 2017-2018 Axel Huebl
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+#include "picongpu/particles/flylite/helperFields/LocalPopulations.hpp"
+#include "picongpu/particles/flylite/helperFields/LocalPopulations.kernel"
+
+// pmacc
+#include <pmacc/Environment.hpp>
+#include <pmacc/traits/GetNumWorkers.hpp>
+
+#include <string>
+
+
+namespace picongpu
+{
+namespace particles
+{
+namespace flylite
+{
+namespace helperFields
+{
+    /** Sum the superconfigurations of an ion species into local populations
+     *
+     * @tparam T_IonSpeciesType a picongpu::Particles class with an ion species
+     */
+    template<
+        typename T_IonSpeciesType
+    >
+    struct FillLocalPopulations
+    {
+        using SpeciesType = T_IonSpeciesType;
+        using FrameType = typename SpeciesType::FrameType;
+
+        /** Functor
+         *
+         * @param currentStep the current time step
+         * @param ionSpeciesName unique name of the ion species
+         */
+        void operator()(
+            uint32_t currentStep,
+            std::string const & ionSpeciesName
+        )
+        {
+            DataConnector &dc = Environment<>::get().DataConnector();
+
+            // load local populations without copy data to host and zero them
+            auto populationsLocal = dc.get< LocalPopulations >(
+                helperFields::LocalPopulations::getName( ionSpeciesName ),
+                true
+            );
+            using Populations = LocalPopulations::Populations;
+            populationsLocal->getGridBuffer().getDeviceBuffer().setValue(
+                Populations( typename Populations::value_type( float_X( 0.0 ) ) )
+            );
+
+            // load particle without copy particle data to host
+            auto speciesTmp = dc.get< SpeciesType >( FrameType::getName(), true );
+
+            // mapper to access species in CORE & BORDER only
+            MappingDesc cellDescription(
+                speciesTmp->getParticlesBuffer().getSuperCellsLayout().getDataSpace() * SuperCellSize::toRT(),
+                GuardSize::toRT()
+            );
+            AreaMapping<
+                CORE + BORDER,
+                MappingDesc
+            > mapper( cellDescription );
+
+            constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+                pmacc::math::CT::volume< SuperCellSize >::type::value
+            >::value;
+            PMACC_KERNEL( helperFields::KernelAddLocalPopulations< numWorkers >{ } )
+            (
+                // one block per supercell
+                mapper.getGridDim(),
+                numWorkers
+            )
+            (
+                // start in border (jump over GUARD area)
+                speciesTmp->getDeviceParticlesBox(),
+                // start in border (has no GUARD area)
+                populationsLocal->getGridBuffer().getDeviceBuffer( ).getDataBox( ),
+                mapper
+            );
+
+            // release fields
+            dc.releaseData( FrameType::getName() );
+            dc.releaseData( helperFields::LocalPopulations::getName( ionSpeciesName ) );
+        }
+    };
+
+} // namespace helperFields
+} // namespace flylite
+} // namespace particles
+} // namespace picongpu
@@ -44,7 +44,11 @@ namespace helperFields
         public ISimulationData
     {
     private:
-        /** A[iz, numpop, numpop] */
+        /** A[iz, numpop, numpop]
+         *
+         * A[iz][i][j] is the rate from population j to population i,
+         * unit: 1 / UNIT_TIME
+         */
         using RateMatrix = memory::Array<
                 memory::Array<
                     memory::Array<
@@ -55,7 +59,7 @@ namespace helperFields
                 >,
                 picongpu::flylite::ionizationStates
         >;
-         GridBuffer< RateMatrix, simDim >* m_rateMatrix;
+        GridBuffer< RateMatrix, simDim >* m_rateMatrix;
         std::string m_speciesName;
 
     public:
@@ -0,0 +1,117 @@
+/* Copyright 2017-2018 Axel Huebl
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+#include "picongpu/particles/flylite/helperFields/LocalRateMatrix.hpp"
+#include "picongpu/particles/flylite/helperFields/LocalRateMatrix.kernel"
+#include "picongpu/particles/flylite/helperFields/LocalEnergyHistogram.hpp"
+#include "picongpu/particles/flylite/helperFields/LocalDensity.hpp"
+#include "picongpu/particles/flylite/rates/CollisionalExcitation.hpp"
+
+// pmacc
+#include <pmacc/Environment.hpp>
+#include <pmacc/traits/GetNumWorkers.hpp>
+
+#include <string>
+
+
+namespace picongpu
+{
+namespace particles
+{
+namespace flylite
+{
+namespace helperFields
+{
+    /** Assemble the local rate matrices of an ion species
+     *
+     * Requires the local density and energy histogram of the free electrons,
+     * see FillLocalDensity and FillLocalEnergyHistogram.
+     *
+     * @todo add photo-excitation from the local photon energy histogram
+     */
+    struct FillLocalRateMatrix
+    {
+        /** Functor
+         *
+         * @param currentStep the current time step
+         * @param ionSpeciesName unique name of the ion species
+         * @param electronsGroup naming for the group of free electron species
+         * @param minEnergy minimum energy of the electron histogram (eV)
+         * @param maxEnergy maximum energy of the electron histogram (eV)
+         */
+        void operator()(
+            uint32_t currentStep,
+            std::string const & ionSpeciesName,
+            std::string const & electronsGroup,
+            float_X const minEnergy,
+            float_X const maxEnergy
+        )
+        {
+            DataConnector &dc = Environment<>::get().DataConnector();
+
+            // load fields without copy data to host
+            auto eneHistLocal = dc.get< LocalEnergyHistogram >(
+                helperFields::LocalEnergyHistogram::getName( electronsGroup ),
+                true
+            );
+            auto densityLocal = dc.get< LocalDensity >(
+                helperFields::LocalDensity::getName( electronsGroup ),
+                true
+            );
+            auto rateMatrix = dc.get< LocalRateMatrix >(
+                helperFields::LocalRateMatrix::getName( ionSpeciesName ),
+                true
+            );
+
+            constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+                pmacc::math::CT::volume< SuperCellSize >::type::value
+            >::value;
+            PMACC_KERNEL(
+                helperFields::KernelFillRateMatrix<
+                    numWorkers,
+                    rates::CollisionalExcitation
+                >{ }
+            )
+            (
+                // one block per averaged cell
+                rateMatrix->getGridBuffer().getGridLayout().getDataSpaceWithoutGuarding(),
+                numWorkers
+            )
+            (
+                eneHistLocal->getGridBuffer().getDeviceBuffer( ).getDataBox( ),
+                densityLocal->getGridBuffer().getDeviceBuffer( ).getDataBox( ),
+                rateMatrix->getGridBuffer().getDeviceBuffer( ).getDataBox( ),
+                minEnergy,
+                maxEnergy
+            );
+
+            // release fields
+            dc.releaseData( helperFields::LocalEnergyHistogram::getName( electronsGroup ) );
+            dc.releaseData( helperFields::LocalDensity::getName( electronsGroup ) );
+            dc.releaseData( helperFields::LocalRateMatrix::getName( ionSpeciesName ) );
+        }
+    };
+
+} // namespace helperFields
+} // namespace flylite
+} // namespace particles
+} // namespace picongpu
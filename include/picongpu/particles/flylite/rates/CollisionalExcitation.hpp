@@ -0,0 +1,182 @@
+/* Copyright 2017-2018 Axel Huebl
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include <pmacc/algorithms/math/defines/pi.hpp>
+
+
+namespace picongpu
+{
+namespace particles
+{
+namespace flylite
+{
+namespace rates
+{
+    /** Collisional excitation and de-excitation between screened hydrogenic levels
+     *
+     * The populations of an ion are the shells n = 1 ... populations of a
+     * screened hydrogenic ion, the charge state iz sees an effective nuclear
+     * charge of Z_eff = iz + 1.
+     *
+     * Excitation uses the van Regemorter cross section with Kramers'
+     * hydrogenic oscillator strengths, de-excitation follows from detailed
+     * balance (Klein-Rosseland relation) so the rates are valid for arbitrary,
+     * non-thermal electron energy distributions.
+     *
+     * H. van Regemorter, Astrophys. J. 136, 906 (1962)
+     *
+     * @todo replace with tabulated atomic data, e.g. from FLYCHK
+     */
+    struct CollisionalExcitation
+    {
+        //! Rydberg energy, unit: eV
+        static constexpr float_64 RYDBERG_eV = 13.605693;
+        //! Bohr radius, unit: m
+        static constexpr float_64 BOHR_RADIUS_SI = 5.2917721e-11;
+        //! electron rest energy m_e * c^2, unit: eV
+        static constexpr float_64 ELECTRON_REST_ENERGY_eV =
+            SI::ELECTRON_MASS_SI * SI::SPEED_OF_LIGHT_SI * SI::SPEED_OF_LIGHT_SI *
+            UNITCONV_Joule_to_keV * 1.0e3;
+
+        /** energy of a transition between two shells
+         *
+         * @param iz ionization state
+         * @param lower index of the lower population (shell n = lower + 1)
+         * @param upper index of the upper population, upper > lower
+         * @return transition energy, unit: eV
+         */
+        HDINLINE static float_X
+        transitionEnergy(
+            uint32_t const iz,
+            uint32_t const lower,
+            uint32_t const upper
+        )
+        {
+            float_X const zEff = float_X( iz + 1u );
+            float_X const nl = float_X( lower + 1u );
+            float_X const nu = float_X( upper + 1u );
+            return float_X( RYDBERG_eV ) * zEff * zEff *
+                ( float_X( 1.0 ) / ( nl * nl ) - float_X( 1.0 ) / ( nu * nu ) );
+        }
+
+        /** statistical weight of a population
+         *
+         * @param pop index of the population (shell n = pop + 1)
+         */
+        HDINLINE static float_X
+        statisticalWeight( uint32_t const pop )
+        {
+            float_X const n = float_X( pop + 1u );
+            return float_X( 2.0 ) * n * n;
+        }
+
+        /** speed of an electron
+         *
+         * @param energy kinetic energy, unit: eV
+         * @return speed in PIConGPU units
+         */
+        HDINLINE static float_X
+        speed( float_X const energy )
+        {
+            float_X const gamma = float_X( 1.0 ) + energy / float_X( ELECTRON_REST_ENERGY_eV );
+            return SPEED_OF_LIGHT *
+                math::sqrt( float_X( 1.0 ) - float_X( 1.0 ) / ( gamma * gamma ) );
+        }
+
+        /** cross section for an excitation lower -> upper
+         *
+         * @param iz ionization state
+         * @param lower index of the lower population
+         * @param upper index of the upper population, upper > lower
+         * @param energy kinetic energy of the free electron, unit: eV
+         * @return cross section in PIConGPU units (UNIT_LENGTH^2),
+         *         zero below threshold
+         */
+        HDINLINE static float_X
+        excitation(
+            uint32_t const iz,
+            uint32_t const lower,
+            uint32_t const upper,
+            float_X const energy
+        )
+        {
+            using pmacc::algorithms::math::Pi;
+
+            float_X const dE = transitionEnergy( iz, lower, upper );
+            if( energy <= dE )
+                return float_X( 0.0 );
+
+            float_X const nl = float_X( lower + 1u );
+            float_X const nu = float_X( upper + 1u );
+            float_X const x = float_X( 1.0 ) / ( nl * nl ) - float_X( 1.0 ) / ( nu * nu );
+            // Kramers' oscillator strength
+            float_X const oscStrength =
+                float_X( 32.0 ) / ( float_X( 3.0 ) * math::sqrt( float_X( 3.0 ) ) * Pi< float_X >::value ) /
+                ( nl * nl * nl * nl * nl * nu * nu * nu * x * x * x );
+            // effective Gaunt factor
+            float_X const gaunt = math::max(
+                float_X( 0.2 ),
+                math::sqrt( float_X( 3.0 ) ) / ( float_X( 2.0 ) * Pi< float_X >::value ) *
+                    math::log( energy / dE )
+            );
+
+            constexpr float_X piA0Sq = float_X(
+                Pi< float_64 >::value * BOHR_RADIUS_SI * BOHR_RADIUS_SI /
+                ( UNIT_LENGTH * UNIT_LENGTH )
+            );
+            float_X const ry = float_X( RYDBERG_eV );
+
+            return float_X( 8.0 ) * Pi< float_X >::value / math::sqrt( float_X( 3.0 ) ) *
+                ( ry / energy ) * ( ry / dE ) * oscStrength * gaunt * piA0Sq;
+        }
+
+        /** cross section for a de-excitation upper -> lower
+         *
+         * @param iz ionization state
+         * @param lower index of the lower population
+         * @param upper index of the upper population, upper > lower
+         * @param energy kinetic energy of the free electron, unit: eV
+         * @return cross section in PIConGPU units (UNIT_LENGTH^2)
+         */
+        HDINLINE static float_X
+        deexcitation(
+            uint32_t const iz,
+            uint32_t const lower,
+            uint32_t const upper,
+            float_X const energy
+        )
+        {
+            if( energy <= float_X( 0.0 ) )
+                return float_X( 0.0 );
+
+            float_X const dE = transitionEnergy( iz, lower, upper );
+            return statisticalWeight( lower ) / statisticalWeight( upper ) *
+                ( energy + dE ) / energy *
+                excitation( iz, lower, upper, energy + dE );
+        }
+    };
+
+} // namespace rates
+} // namespace flylite
+} // namespace particles
+} // namespace picongpu
@@ -0,0 +1,106 @@
+/* Copyright 2017-2018 Axel Huebl
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+#include "picongpu/particles/flylite/helperFields/LocalRateMatrix.hpp"
+#include "picongpu/particles/flylite/helperFields/LocalPopulations.hpp"
+#include "picongpu/particles/flylite/solver/ImplicitRateEquations.kernel"
+
+// pmacc
+#include <pmacc/Environment.hpp>
+#include <pmacc/traits/GetNumWorkers.hpp>
+
+#include <string>
+
+
+namespace picongpu
+{
+namespace particles
+{
+namespace flylite
+{
+namespace solver
+{
+    /** Evolve the local populations of an ion species by one time step
+     *
+     * Requires the local populations and rate matrices of the ion species,
+     * see helperFields::FillLocalPopulations and
+     * helperFields::FillLocalRateMatrix.
+     */
+    struct SolveRateEquations
+    {
+        /** Functor
+         *
+         * @param currentStep the current time step
+         * @param ionSpeciesName unique name of the ion species
+         */
+        void operator()(
+            uint32_t currentStep,
+            std::string const & ionSpeciesName
+        )
+        {
+            DataConnector &dc = Environment<>::get().DataConnector();
+
+            // load fields without copy data to host
+            auto rateMatrix = dc.get< helperFields::LocalRateMatrix >(
+                helperFields::LocalRateMatrix::getName( ionSpeciesName ),
+                true
+            );
+            auto populationsLocal = dc.get< helperFields::LocalPopulations >(
+                helperFields::LocalPopulations::getName( ionSpeciesName ),
+                true
+            );
+
+            DataSpace< simDim > const avgGridSize =
+                populationsLocal->getGridBuffer().getGridLayout().getDataSpaceWithoutGuarding();
+            uint32_t const numSystems =
+                avgGridSize.productOfComponents() * picongpu::flylite::ionizationStates;
+
+            /* one small dense system per worker, the block size is only a
+             * batching of independent systems
+             */
+            constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+                pmacc::math::CT::volume< SuperCellSize >::type::value
+            >::value;
+            uint32_t const numBlocks = ( numSystems + numWorkers - 1u ) / numWorkers;
+
+            PMACC_KERNEL( KernelSolveRateEquations< numWorkers >{ } )
+            (
+                numBlocks,
+                numWorkers
+            )
+            (
+                rateMatrix->getGridBuffer().getDeviceBuffer( ).getDataBox( ),
+                populationsLocal->getGridBuffer().getDeviceBuffer( ).getDataBox( ),
+                avgGridSize,
+                DELTA_T
+            );
+
+            // release fields
+            dc.releaseData( helperFields::LocalRateMatrix::getName( ionSpeciesName ) );
+            dc.releaseData( helperFields::LocalPopulations::getName( ionSpeciesName ) );
+        }
+    };
+
+} // namespace solver
+} // namespace flylite
+} // namespace particles
+} // namespace picongpu
@@ -372,10 +372,11 @@ namespace ionization
                  * - momentum: because the electron would get a higher energy because of the ion mass
                  * - boundElectrons: because species other than ions or atoms do not have them
                  * (gets AUTOMATICALLY deselected because electrons do not have this attribute)
+                 * - particleId: is assigned by the particle creation kernel
                  */
-                auto targetElectronClone = partOp::deselect<bmpl::vector2<multiMask, momentum> >(childElectron);
+                auto targetElectronClone = partOp::deselect<bmpl::vector3<multiMask, momentum, particleId> >(childElectron);
 
-                partOp::assign(targetElectronClone, partOp::deselect<particleId>(parentIon));
+                partOp::assign(targetElectronClone, parentIon);
 
                 const float_X massIon = attribute::getMass(weighting,parentIon);
                 const float_X massElectron = attribute::getMass(weighting,childElectron);
@@ -378,10 +378,12 @@ public:
             parOp::deselect<
                 boost::mpl::vector<
                     multiMask,
-                    momentum
+                    momentum,
+                    // assigned by the particle creation kernel
+                    particleId
                 >
             >(photon);
-        parOp::assign( destPhoton, parOp::deselect<particleId>(electron) );
+        parOp::assign( destPhoton, electron );
 
         photon[multiMask_] = 1;
         photon[momentum_] = this->photon_mom;
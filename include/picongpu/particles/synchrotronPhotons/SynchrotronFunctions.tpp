@@ -20,6 +20,7 @@
 #pragma once
 
 #include "picongpu/particles/synchrotronPhotons/SynchrotronFunctions.hpp"
+#include "picongpu/particles/LookupTableCache.hpp"
 #include "picongpu/simulation_defines.hpp"
 #include <boost/array.hpp>
 #if( BOOST_VERSION == 106400 )
@@ -107,17 +108,40 @@ void SynchrotronFunctions::init()
     pmacc::container::HostBuffer<float_X, DIM1> hBuf_F_1(numSamples);
     pmacc::container::HostBuffer<float_X, DIM1> hBuf_F_2(numSamples);
 
+    /* all values the table depends on, the version must be increased
+     * if the computation of the table changes
+     */
+    std::stringstream key = LookupTableCache::createKey("synchrotronFunctions");
+    key << " version=1"
+        << " numSamples=" << numSamples
+        << " stepWidth=" << SYNC_FUNCS_STEP_WIDTH
+        << " f1IntegralBound=" << SYNC_FUNCS_F1_INTEGRAL_BOUND
+        << " besselIntegralStepWidth=" << SYNC_FUNCS_BESSEL_INTEGRAL_STEPWIDTH;
+
+    // an entry holds F_1 and F_2 of a sample
+    std::vector<float_X> const table = LookupTableCache::getInstance().getTable(
+        "synchrotronFunctions",
+        key.str(),
+        numSamples,
+        2u,
+        [this](const uint32_t sampleIdx, float_X* values)
+        {
+            const float_64 x_m = float_64(sampleIdx) * SYNC_FUNCS_STEP_WIDTH;
+            /* This mapping increases the sample point density for small values of x
+             * where the synchrotron functions have a divergent slope. Without this mapping
+             * the emission probabilty of low-energy photons is underestimated.
+             */
+            const float_64 x = x_m * x_m * x_m;
+
+            values[first] = static_cast<float_X>(this->F_1(x));
+            values[second] = static_cast<float_X>(this->F_2(x));
+        }
+    );
+
     for(uint32_t sampleIdx = 0u; sampleIdx < numSamples; sampleIdx++)
     {
-        const float_64 x_m = float_64(sampleIdx) * SYNC_FUNCS_STEP_WIDTH;
-        /* This mapping increases the sample point density for small values of x
-         * where the synchrotron functions have a divergent slope. Without this mapping
-         * the emission probabilty of low-energy photons is underestimated.
-         */
-        const float_64 x = x_m * x_m * x_m;
-
-        hBuf_F_1.origin()[sampleIdx] = static_cast<float_X>(this->F_1(x));
-        hBuf_F_2.origin()[sampleIdx] = static_cast<float_X>(this->F_2(x));
+        hBuf_F_1.origin()[sampleIdx] = table[2u * sampleIdx + first];
+        hBuf_F_2.origin()[sampleIdx] = table[2u * sampleIdx + second];
     }
 
     *this->dBuf_SyncFuncs[first] = hBuf_F_1;
@@ -0,0 +1,63 @@
+/* Copyright 2018 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include <pmacc/traits/HasFlag.hpp>
+
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/bool.hpp>
+
+
+namespace picongpu
+{
+namespace particles
+{
+namespace traits
+{
+    /** Check if the current of a species is deposited by its push kernel
+     *
+     * Defines a boost::mpl::bool_ true type if the fused push and deposit is
+     * enabled in pusher.param and the species has a pusher and a current solver.
+     *
+     * @tparam T_Species particle species type
+     */
+    template< typename T_Species >
+    struct HasFusedCurrent
+    {
+        using FrameType = typename T_Species::FrameType;
+
+        using type = typename boost::mpl::and_<
+            boost::mpl::bool_< particlePushAndDeposit::fused >,
+            typename pmacc::traits::HasFlag<
+                FrameType,
+                particlePusher< >
+            >::type,
+            typename pmacc::traits::HasFlag<
+                FrameType,
+                current< >
+            >::type
+        >::type;
+    };
+
+} // namespace traits
+} // namespace particles
+} // namespace picongpu
@@ -23,26 +23,12 @@
 #include "picongpu/simulation_defines.hpp"
 
 #include "picongpu/plugins/ISimulationPlugin.hpp"
-#include "picongpu/algorithms/Gamma.hpp"
-#include "picongpu/algorithms/KinEnergy.hpp"
 #include "picongpu/particles/traits/SpeciesEligibleForSolver.hpp"
 #include "picongpu/plugins/multi/multi.hpp"
-#include "picongpu/particles/traits/SpeciesEligibleForSolver.hpp"
+#include "picongpu/plugins/particleReduction/ParticleReductionPipeline.hpp"
 #include "picongpu/particles/traits/GenerateSolversIfSpeciesEligible.hpp"
 #include "picongpu/plugins/misc/misc.hpp"
 
-#include <pmacc/mpi/reduceMethods/Reduce.hpp>
-#include <pmacc/mpi/MPIReduce.hpp>
-#include <pmacc/nvidia/functors/Add.hpp>
-#include <pmacc/dataManagement/DataConnector.hpp>
-#include <pmacc/mappings/kernel/AreaMapping.hpp>
-#include <pmacc/memory/shared/Allocate.hpp>
-#include <pmacc/dimensions/DataSpace.hpp>
-#include <pmacc/traits/GetNumWorkers.hpp>
-#include <pmacc/mappings/threads/ForEachIdx.hpp>
-#include <pmacc/mappings/threads/IdxConfig.hpp>
-#include <pmacc/math/Vector.hpp>
-#include <pmacc/nvidia/atomic.hpp>
 #include <pmacc/traits/HasIdentifiers.hpp>
 #include <pmacc/traits/HasFlag.hpp>
 
@@ -62,240 +48,6 @@ using namespace pmacc;
 
 namespace po = boost::program_options;
 
-/** calculate a energy histogram of a species
- *
- * if a particle filter is given, only the filtered particles are counted
- *
- * @tparam T_numWorkers number of workers
- */
-template< uint32_t T_numWorkers >
-struct KernelBinEnergyParticles
-{
-    /* sum up the energy of all particles
-     *
-     * the kinetic energy of all active particles will be calculated
-     *
-     * @tparam T_ParBox pmacc::ParticlesBox, particle box type
-     * @tparam T_BinBox pmacc::DataBox, box type for the histogram in global memory
-     * @tparam T_Mapping type of the mapper to map a cuda block to a supercell index
-     * @tparam T_Acc alpaka accelerator type
-     *
-     * @param acc alpaka accelerator
-     * @param pb box with access to the particles of the current used species
-     * @param gBins box with memory for resulting histogram
-     * @param numBins number of bins in the histogram (must be fit into the shared memory)
-     * @param minEnergy particle energy for the first bin
-     * @param maxEnergy particle energy for the last bin
-     * @param mapper functor to map a cuda block to a supercells index
-     */
-    template<
-        typename T_ParBox,
-        typename T_BinBox,
-        typename T_Mapping,
-        typename T_Filter,
-        typename T_Acc
-    >
-    DINLINE void operator()(
-        T_Acc const & acc,
-        T_ParBox pb,
-        T_BinBox gBins,
-        int const numBins,
-        float_X const minEnergy,
-        float_X const maxEnergy,
-        T_Mapping const mapper,
-        T_Filter filter
-    ) const
-    {
-        using namespace pmacc::mappings::threads;
-        using SuperCellSize = typename MappingDesc::SuperCellSize;
-        using FramePtr = typename T_ParBox::FramePtr;
-        constexpr uint32_t maxParticlesPerFrame = pmacc::math::CT::volume< SuperCellSize >::type::value;
-        constexpr uint32_t numWorkers = T_numWorkers;
-
-        PMACC_SMEM(
-            acc,
-            frame,
-            FramePtr
-        );
-
-        PMACC_SMEM(
-            acc,
-            particlesInSuperCell,
-            lcellId_t
-        );
-
-        /* shBins index can go from 0 to (numBins+2)-1
-         * 0 is for <minEnergy
-         * (numBins+2)-1 is for >maxEnergy
-         */
-        sharedMemExtern(shBin,float_X); /* size must be numBins+2 because we have <min and >max */
-
-
-        int const realNumBins = numBins + 2;
-
-        uint32_t const workerIdx = threadIdx.x;
-
-        using MasterOnly = IdxConfig<
-            1,
-            numWorkers
-        >;
-
-        DataSpace< simDim > const superCellIdx(
-            mapper.getSuperCellIndex( DataSpace< simDim >( blockIdx ) )
-        );
-
-        ForEachIdx< MasterOnly >{ workerIdx }(
-            [&](
-                uint32_t const,
-                uint32_t const
-            )
-            {
-                frame = pb.getLastFrame( superCellIdx );
-                particlesInSuperCell = pb.getSuperCell( superCellIdx ).getSizeLastFrame( );
-            }
-        );
-
-        ForEachIdx<
-            IdxConfig<
-                numWorkers,
-                numWorkers
-            >
-        >{ workerIdx }(
-            [&](
-                uint32_t const linearIdx,
-                uint32_t const
-            )
-            {
-                /* set all bins to 0 */
-                for( int i = linearIdx; i < realNumBins; i += numWorkers )
-                    shBin[ i ] = float_X( 0. );
-            }
-        );
-
-        __syncthreads();
-
-        if( !frame.isValid( ) )
-          return; /* end kernel if we have no frames */
-
-        auto accFilter = filter(
-            acc,
-            superCellIdx - mapper.getGuardingSuperCells( ),
-            WorkerCfg< numWorkers >{ workerIdx }
-        );
-
-        while( frame.isValid() )
-        {
-            // move over all particles in a frame
-            ForEachIdx<
-                IdxConfig<
-                    maxParticlesPerFrame,
-                    numWorkers
-                >
-            >{ workerIdx }(
-                [&](
-                    uint32_t const linearIdx,
-                    uint32_t const
-                )
-                {
-                    if( linearIdx < particlesInSuperCell )
-                    {
-                        auto const particle = frame[ linearIdx ];
-                        if(
-                            accFilter(
-                                acc,
-                                particle
-                            )
-                        )
-                        {
-                            /* kinetic Energy for Particles: E^2 = p^2*c^2 + m^2*c^4
-                             *                                   = c^2 * [p^2 + m^2*c^2]
-                             */
-                            float3_X const mom = particle[ momentum_ ];
-                            float_X const weighting = particle[ weighting_ ];
-                            float_X const mass = attribute::getMass(
-                                weighting,
-                                particle
-                            );
-
-                            // calculate kinetic energy of the macro particle
-                            float_X localEnergy = KinEnergy< >( )(
-                                mom,
-                                mass
-                            );
-
-                            localEnergy /= weighting;
-
-                            /* +1 move value from 1 to numBins+1 */
-                            int binNumber = math::floor(
-                                ( localEnergy - minEnergy ) /
-                                ( maxEnergy - minEnergy ) * static_cast< float_X >( numBins )
-                            )  + 1;
-
-                            int const maxBin = numBins + 1;
-
-                            /* all entries larger than maxEnergy go into bin maxBin */
-                            binNumber = binNumber < maxBin ? binNumber : maxBin;
-
-                            /* all entries smaller than minEnergy go into bin zero */
-                            binNumber = binNumber > 0 ? binNumber : 0;
-
-                            /*!\todo: we can't use 64bit type on this place (NVIDIA BUG?)
-                             * COMPILER ERROR: ptxas /tmp/tmpxft_00005da6_00000000-2_main.ptx, line 4246; error   : Global state space expected for instruction 'atom'
-                             * I think this is a problem with extern shared mem and atmic (only on TESLA)
-                             * NEXT BUG: don't do uint32_t w=__float2uint_rn(weighting); and use w for atomic, this create wrong results
-                             *
-                             * uses a normed float weighting to avoid an overflow of the floating point result
-                             * for the reduced weighting if the particle weighting is very large
-                             */
-                            float_X const normedWeighting = weighting /
-                                float_X( particles::TYPICAL_NUM_PARTICLES_PER_MACROPARTICLE );
-                            atomicAdd(
-                                &( shBin[ binNumber ] ),
-                                normedWeighting,
-                                ::alpaka::hierarchy::Threads{}
-                            );
-                        }
-                    }
-                }
-            );
-
-            __syncthreads();
-
-            ForEachIdx< MasterOnly >{ workerIdx }(
-                [&](
-                    uint32_t const,
-                    uint32_t const
-                )
-                {
-                    frame = pb.getPreviousFrame( frame );
-                    particlesInSuperCell = maxParticlesPerFrame;
-                }
-            );
-            __syncthreads();
-        }
-
-        ForEachIdx<
-            IdxConfig<
-                numWorkers,
-                numWorkers
-            >
-        >{ workerIdx }(
-            [&](
-                uint32_t const linearIdx,
-                uint32_t const
-            )
-            {
-                for( int i = linearIdx; i < realNumBins; i += numWorkers )
-                    atomicAdd(
-                        &( gBins[ i ] ),
-                        float_64( shBin[ i ] ),
-                        ::alpaka::hierarchy::Blocks{}
-                    );
-            }
-        );
-    }
-};
-
 template<class ParticlesType>
 class BinEnergyParticles : public plugins::multi::ISlave
 {
@@ -462,13 +214,10 @@ private:
         std::string const prefix = ParticlesType::FrameType::getName( ) + std::string( "_energyHistogram" );
     };
 
-    GridBuffer<float_64, DIM1> *gBins = nullptr;
     MappingDesc *m_cellDescription = nullptr;
 
     std::string filename;
 
-    float_64 * binReduced = nullptr;
-
     int numBins;
     int realNumBins;
     /* variables for energy limits of the histogram in keV */
@@ -480,7 +229,8 @@ private:
     /* only rank 0 create a file */
     bool writeToFile = false;
 
-    mpi::MPIReduce reduce;
+    //! computes the histogram together with other particle reductions
+    std::shared_ptr< plugins::particleReduction::ParticleReductionPipeline > m_pipeline;
 
     std::shared_ptr< Help > m_help;
     size_t m_id;
@@ -521,15 +271,11 @@ public:
 
         realNumBins = numBins + 2;
 
-        /* create an array of float_64 on gpu und host */
-        gBins = new GridBuffer<float_64, DIM1 > (DataSpace<DIM1 > (realNumBins));
-        binReduced = new float_64[realNumBins];
-        for (int i = 0; i < realNumBins; ++i)
-        {
-            binReduced[i] = 0.0;
-        }
+        m_pipeline = plugins::particleReduction::ParticleReductionPipeline::getInstance(
+            cellDescription
+        );
 
-        writeToFile = reduce.hasResult(mpi::reduceMethods::Reduce());
+        writeToFile = m_pipeline->hasResult();
         if( writeToFile )
             openNewFile();
 
@@ -551,14 +297,35 @@ public:
                 std::cerr << "Error on flushing file [" << filename << "]. " << std::endl;
             outFile.close();
         }
-
-        __delete(gBins);
-        __deleteArray(binReduced);
     }
 
+    /** request the histogram of the current step
+     *
+     * The histogram is computed by the particle reduction pipeline together
+     * with all other particle reductions of this step.
+     */
     void notify(uint32_t currentStep)
     {
-        calBinEnergyParticles < CORE + BORDER > (currentStep);
+        /* convert energy values from keV to PIConGPU units */
+        float_X const minEnergy = minEnergy_keV * UNITCONV_keV_to_Joule / UNIT_ENERGY;
+        float_X const maxEnergy = maxEnergy_keV * UNITCONV_keV_to_Joule / UNIT_ENERGY;
+
+        m_pipeline->requestEnergyHistogram< ParticlesType >(
+            m_help->filter.get( m_id ),
+            numBins,
+            minEnergy,
+            maxEnergy,
+            [ this, currentStep ](
+                float_64 const *,
+                float_64 const * binReduced
+            )
+            {
+                writeHistogram(
+                    currentStep,
+                    binReduced
+                );
+            }
+        );
     }
 
     void restart(
@@ -621,62 +388,13 @@ private:
         }
     }
 
-    template< uint32_t AREA >
-    void calBinEnergyParticles(uint32_t currentStep)
+    /** write the histogram of a step to the output file
+     *
+     * @param currentStep time step of the histogram
+     * @param binReduced histogram reduced over all ranks (realNumBins elements)
+     */
+    void writeHistogram(uint32_t const currentStep, float_64 const * binReduced)
     {
-        gBins->getDeviceBuffer().setValue(0);
-
-        DataConnector &dc = Environment<>::get().DataConnector();
-        auto particles = dc.get< ParticlesType >( ParticlesType::FrameType::getName(), true );
-
-        /* convert energy values from keV to PIConGPU units */
-        float_X const minEnergy = minEnergy_keV * UNITCONV_keV_to_Joule / UNIT_ENERGY;
-        float_X const maxEnergy = maxEnergy_keV * UNITCONV_keV_to_Joule / UNIT_ENERGY;
-
-        constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
-             pmacc::math::CT::volume< SuperCellSize >::type::value
-         >::value;
-
-        AreaMapping<
-            AREA,
-            MappingDesc
-        > mapper( *m_cellDescription );
-
-        auto kernel = PMACC_KERNEL( KernelBinEnergyParticles< numWorkers >{ } )(
-            mapper.getGridDim( ),
-            numWorkers,
-            realNumBins * sizeof( float_X )
-        );
-
-        auto bindKernel = std::bind(
-            kernel,
-            particles->getDeviceParticlesBox( ),
-            gBins->getDeviceBuffer( ).getDataBox( ),
-            numBins,
-            minEnergy,
-            maxEnergy,
-            mapper,
-            std::placeholders::_1
-        );
-
-        ForEach<
-            typename Help::EligibleFilters,
-            plugins::misc::ExecuteIfNameIsEqual< bmpl::_1 >
-        >{ }(
-            m_help->filter.get( m_id ),
-            currentStep,
-            bindKernel
-        );
-
-        dc.releaseData( ParticlesType::FrameType::getName() );
-        gBins->deviceToHost();
-
-        reduce(nvidia::functors::Add(),
-               binReduced,
-               gBins->getHostBuffer().getBasePointer(),
-               realNumBins, mpi::reduceMethods::Reduce());
-
-
         if (writeToFile)
         {
             using dbl = std::numeric_limits<float_64>;
@@ -34,7 +34,7 @@
 #include <pmacc/cuSTL/container/HostBuffer.hpp>
 #include <pmacc/cuSTL/container/PseudoBuffer.hpp>
 #include <pmacc/cuSTL/cursor/NestedCursor.hpp>
-#include <pmacc/cuSTL/algorithm/kernel/Foreach.hpp>
+#include <pmacc/cuSTL/algorithm/kernel/run-time/Foreach.hpp>
 #include <pmacc/cuSTL/algorithm/host/Foreach.hpp>
 #include <pmacc/cuSTL/algorithm/mpi/Gather.hpp>
 #include <pmacc/cuSTL/algorithm/kernel/Reduce.hpp>
@@ -268,7 +268,7 @@ void ChargeConservation::notify(uint32_t currentStep)
     /* run calculation: fieldTmp = | div E * eps_0 - rho | */
     using namespace pmacc::math::math_functor;
     typedef picongpu::detail::Div<simDim, typename FieldTmp::ValueType> myDiv;
-    algorithm::kernel::Foreach<BlockDim>()(
+    algorithm::kernel::RT::Foreach()(
         fieldTmp_coreBorder.zone(),
         fieldTmp_coreBorder.origin(),
         cursor::make_NestedCursor(fieldE_coreBorder.origin()),
@@ -30,6 +30,7 @@
 #if(ENABLE_HDF5 == 1)
 #   include "picongpu/plugins/hdf5/HDF5Writer.hpp"
 #endif
+#include "picongpu/plugins/native/NativeWriter.hpp"
 #include <pmacc/pluginSystem/PluginConnector.hpp>
 
 #include <string>
@@ -58,7 +59,10 @@ namespace picongpu
 #if(ENABLE_HDF5 == 1)
             ioBackendsHelp[ "hdf5" ] = std::shared_ptr< plugins::multi::IHelp >( hdf5::HDF5Writer::getHelp() );
 #endif
-            // if adios is enabled the default is adios
+            ioBackendsHelp[ "native" ] = std::shared_ptr< plugins::multi::IHelp >( native::NativeWriter::getHelp() );
+            /* if adios is enabled the default is adios, native is only the
+             * default if neither adios nor hdf5 is available
+             */
             if( !ioBackendsHelp.empty( ) )
             {
                 checkpointBackendName = ioBackendsHelp.begin( )->first;
@@ -255,7 +259,7 @@ namespace picongpu
          */
         uint32_t restartChunkSize;
 
-        // can be "adios" and "hdf5"
+        // can be "adios", "hdf5" and "native"
         std::map<
             std::string,
             std::shared_ptr< IIOBackend >
@@ -24,15 +24,12 @@
 #include <pmacc/mappings/kernel/AreaMapping.hpp>
 
 #include "picongpu/plugins/ISimulationPlugin.hpp"
+#include "picongpu/plugins/particleReduction/ParticleReductionPipeline.hpp"
 #include "picongpu/particles/filter/filter.hpp"
 
 #include <pmacc/mpi/reduceMethods/Reduce.hpp>
 #include <pmacc/mpi/MPIReduce.hpp>
-#include <pmacc/nvidia/functors/Add.hpp>
 #include <pmacc/nvidia/functors/Max.hpp>
-#include <pmacc/dataManagement/DataConnector.hpp>
-
-#include <pmacc/particles/operations/CountParticles.hpp>
 
 #include "common/txtFileHandling.hpp"
 
@@ -63,6 +60,10 @@ private:
     /*only rank 0 create a file*/
     bool writeToFile;
 
+    //! counts the particles together with other particle reductions
+    std::shared_ptr< plugins::particleReduction::ParticleReductionPipeline > pipeline;
+
+    //! reduce of the maximum number of particles per rank
     mpi::MPIReduce reduce;
 public:
 
@@ -81,9 +82,27 @@ public:
 
     }
 
+    /** request the number of particles of the current step
+     *
+     * The particles are counted by the particle reduction pipeline together
+     * with all other particle reductions of this step.
+     */
     void notify(uint32_t currentStep)
     {
-        countParticles < CORE + BORDER > (currentStep);
+        pipeline->requestCount< ParticlesType >(
+            particles::filter::All::getName(),
+            [ this, currentStep ](
+                float_64 const * localCount,
+                float_64 const * reducedCount
+            )
+            {
+                writeCount(
+                    currentStep,
+                    static_cast< uint64_cu >( *localCount ),
+                    static_cast< uint64_cu >( *reducedCount )
+                );
+            }
+        );
     }
 
     void pluginRegisterHelp(po::options_description& desc)
@@ -109,7 +128,8 @@ private:
     {
         if(!notifyPeriod.empty())
         {
-            writeToFile = reduce.hasResult(mpi::reduceMethods::Reduce());
+            pipeline = plugins::particleReduction::ParticleReductionPipeline::getInstance(cellDescription);
+            writeToFile = pipeline->hasResult();
 
             if (writeToFile)
             {
@@ -139,6 +159,7 @@ private:
                     std::cerr << "Error on flushing file [" << filename << "]. " << std::endl;
                 outFile.close();
             }
+            pipeline.reset();
         }
     }
 
@@ -164,28 +185,14 @@ private:
                            checkpointDirectory );
     }
 
-    template< uint32_t AREA>
-    void countParticles(uint32_t currentStep)
+    /** write the number of particles of a step to the output file
+     *
+     * @param currentStep time step of the count
+     * @param size number of particles on this rank
+     * @param reducedValue number of particles on all ranks
+     */
+    void writeCount(uint32_t currentStep, uint64_cu size, uint64_cu const reducedValue)
     {
-        uint64_cu size;
-
-        const SubGrid<simDim>& subGrid = Environment<simDim>::get().SubGrid();
-        const DataSpace<simDim> localSize(subGrid.getLocalDomain().size);
-
-        DataConnector &dc = Environment<>::get().DataConnector();
-        auto particles = dc.get< ParticlesType >( ParticlesType::FrameType::getName(), true );
-
-        // enforce that the filter interface is fulfilled
-        particles::filter::IUnary< particles::filter::All > parFilter{ currentStep };
-
-        /*count local particles*/
-        size = pmacc::CountParticles::countOnDevice<AREA>(*particles,
-                                                          *cellDescription,
-                                                          DataSpace<simDim>(),
-                                                          localSize,
-                                                          parFilter);
-        dc.releaseData( ParticlesType::FrameType::getName() );
-
         uint64_cu reducedValueMax;
         if (picLog::log_level & picLog::CRITICAL::lvl)
         {
@@ -197,13 +204,6 @@ private:
         }
 
 
-        uint64_cu reducedValue;
-        reduce(nvidia::functors::Add(),
-               &reducedValue,
-               &size,
-               1,
-               mpi::reduceMethods::Reduce());
-
         if (writeToFile)
         {
             if (picLog::log_level & picLog::CRITICAL::lvl)
@@ -21,24 +21,13 @@
 #pragma once
 
 #include "picongpu/simulation_defines.hpp"
-#include "picongpu/algorithms/KinEnergy.hpp"
 #include "picongpu/plugins/common/txtFileHandling.hpp"
 #include "picongpu/plugins/multi/multi.hpp"
+#include "picongpu/plugins/particleReduction/ParticleReductionPipeline.hpp"
 #include "picongpu/particles/traits/SpeciesEligibleForSolver.hpp"
 #include "picongpu/particles/traits/GenerateSolversIfSpeciesEligible.hpp"
 #include "picongpu/plugins/misc/misc.hpp"
 
-#include <pmacc/mappings/kernel/AreaMapping.hpp>
-#include <pmacc/mpi/reduceMethods/Reduce.hpp>
-#include <pmacc/mpi/MPIReduce.hpp>
-#include <pmacc/nvidia/functors/Add.hpp>
-#include <pmacc/memory/shared/Allocate.hpp>
-#include <pmacc/dataManagement/DataConnector.hpp>
-#include <pmacc/nvidia/atomic.hpp>
-#include <pmacc/mappings/threads/ForEachIdx.hpp>
-#include <pmacc/mappings/threads/IdxConfig.hpp>
-#include <pmacc/memory/CtxArray.hpp>
-#include <pmacc/traits/GetNumWorkers.hpp>
 #include <pmacc/traits/HasIdentifiers.hpp>
 #include <pmacc/traits/HasFlag.hpp>
 #include <pmacc/algorithms/ForEach.hpp>
@@ -55,240 +44,6 @@
 namespace picongpu
 {
 
-    /** accumulate the kinetic and total energy
-     *
-     * All energies are summed over all particles of a species.
-     *
-     * @tparam T_numWorkers number of workers
-     */
-    template< uint32_t T_numWorkers >
-    struct KernelEnergyParticles
-    {
-
-        /** accumulate particle energies
-         *
-         * @tparam T_ParBox pmacc::ParticlesBox, particle box type
-         * @tparam T_DBox pmacc::DataBox, type of the memory box for the reduced energies
-         * @tparam T_Mapping mapper functor type
-         *
-         * @param pb particle memory
-         * @param gEnergy storage for the reduced energies
-         *                (two elements 0 == kinetic; 1 == total energy)
-         * @param mapper functor to map a block to a supercell
-         */
-        template<
-            typename T_ParBox,
-            typename T_DBox,
-            typename T_Mapping,
-            typename T_Acc,
-            typename T_Filter
-        >
-        DINLINE void operator( )(
-            T_Acc const & acc,
-            T_ParBox pb,
-            T_DBox gEnergy,
-            T_Mapping mapper,
-            T_Filter filter
-        ) const
-        {
-            using namespace mappings::threads;
-
-            constexpr uint32_t numWorkers = T_numWorkers;
-            constexpr uint32_t numParticlesPerFrame = pmacc::math::CT::volume<
-                typename T_ParBox::FrameType::SuperCellSize
-            >::type::value;
-
-            uint32_t const workerIdx = threadIdx.x;
-
-            using FramePtr = typename T_ParBox::FramePtr;
-
-            // shared kinetic energy
-            PMACC_SMEM(
-                acc,
-                shEnergyKin,
-                float_X
-            );
-            // shared total energy
-            PMACC_SMEM(
-                acc,
-                shEnergy,
-                float_X
-            );
-
-            using ParticleDomCfg = IdxConfig<
-                numParticlesPerFrame,
-                numWorkers
-            >;
-
-            // sum kinetic energy for all particles touched by the virtual thread
-            float_X localEnergyKin( 0.0 );
-            float_X localEnergy( 0.0 );
-
-            using MasterOnly = IdxConfig<
-                1,
-                numWorkers
-            >;
-
-
-            ForEachIdx< MasterOnly >{ workerIdx }(
-                [&](
-                    uint32_t const,
-                    uint32_t const
-                )
-                {
-                    // set shared kinetic energy to zero
-                    shEnergyKin = float_X( 0.0 );
-                    // set shared total energy to zero
-                    shEnergy = float_X( 0.0 );
-                }
-            );
-
-            __syncthreads( );
-
-            DataSpace< simDim > const superCellIdx( mapper.getSuperCellIndex(
-                DataSpace< simDim >( blockIdx )
-            ));
-
-            // each virtual thread is working on an own frame
-            FramePtr frame = pb.getLastFrame( superCellIdx );
-
-            // end kernel if we have no frames within the supercell
-            if( !frame.isValid( ) )
-                return;
-
-            auto accFilter = filter(
-                acc,
-                superCellIdx - mapper.getGuardingSuperCells( ),
-                WorkerCfg< numWorkers >{ workerIdx }
-            );
-
-            memory::CtxArray<
-                typename FramePtr::type::ParticleType,
-                ParticleDomCfg
-            >
-            currentParticleCtx(
-                workerIdx,
-                [&](
-                    uint32_t const linearIdx,
-                    uint32_t const
-                )
-                {
-                    auto particle = frame[ linearIdx ];
-                    /* - only particles from the last frame must be checked
-                     * - all other particles are always valid
-                     */
-                    if( particle[ multiMask_ ] != 1 )
-                        particle.setHandleInvalid( );
-                    return particle;
-                }
-            );
-
-            while( frame.isValid( ) )
-            {
-                // loop over all particles in the frame
-                ForEachIdx< ParticleDomCfg > forEachParticle( workerIdx );
-
-                forEachParticle(
-                    [&](
-                        uint32_t const linearIdx,
-                        uint32_t const idx
-                    )
-                    {
-                        /* get one particle */
-                        auto & particle = currentParticleCtx[ idx ];
-                        if(
-                            accFilter(
-                                acc,
-                                particle
-                            )
-                        )
-                        {
-                            float3_X const mom = particle[ momentum_ ];
-                            // compute square of absolute momentum of the particle
-                            float_X const mom2 = math::abs2( mom );
-                            float_X const weighting = particle[ weighting_ ];
-                            float_X const mass = attribute::getMass(
-                                weighting,
-                                particle
-                            );
-                            float_X const c2 = SPEED_OF_LIGHT * SPEED_OF_LIGHT;
-
-                            // calculate kinetic energy of the macro particle
-                            localEnergyKin += KinEnergy<>( )(
-                                mom,
-                                mass
-                            );
-
-                            /* total energy for particles:
-                             *    E^2 = p^2*c^2 + m^2*c^4
-                             *        = c^2 * [p^2 + m^2*c^2]
-                             */
-                            localEnergy += algorithms::math::sqrt(
-                                mom2 +
-                                mass * mass * c2
-                            ) * SPEED_OF_LIGHT;
-
-                        }
-                    }
-                );
-
-                // set frame to next particle frame
-                frame = pb.getPreviousFrame(frame);
-                forEachParticle(
-                    [&](
-                        uint32_t const linearIdx,
-                        uint32_t const idx
-                    )
-                    {
-                        /* Update particle for the next round.
-                         * The frame list is traverse from the last to the first frame.
-                         * Only the last frame can contain gaps therefore all following
-                         * frames are filled with fully particles.
-                         */
-                        currentParticleCtx[ idx ] = frame[ linearIdx ];
-                    }
-                );
-            }
-
-            // each virtual thread adds the energies to the shared memory
-            atomicAdd(
-                &shEnergyKin,
-                localEnergyKin,
-                ::alpaka::hierarchy::Threads{}
-            );
-            atomicAdd(
-                &shEnergy,
-                localEnergy,
-                ::alpaka::hierarchy::Threads{}
-            );
-
-            // wait that all virtual threads updated the shared memory energies
-            __syncthreads( );
-
-            // add energies on global level using global memory
-            ForEachIdx< MasterOnly >{ workerIdx }(
-                [&](
-                    uint32_t const,
-                    uint32_t const
-                )
-                {
-                    // add kinetic energy
-                    atomicAdd(
-                        &( gEnergy[ 0 ] ),
-                        static_cast< float_64 >( shEnergyKin ),
-                        ::alpaka::hierarchy::Blocks{}
-                    );
-                    // add total energy
-                    atomicAdd(
-                        &( gEnergy[ 1 ] ),
-                        static_cast< float_64 >( shEnergy ),
-                        ::alpaka::hierarchy::Blocks{}
-                    );
-                }
-            );
-        }
-    };
-
     template< typename ParticlesType >
     class EnergyParticles : public plugins::multi::ISlave
     {
@@ -445,14 +200,12 @@ namespace picongpu
         {
             filename = m_help->getOptionPrefix() + "_" + m_help->filter.get( m_id ) + ".dat";
 
-            // decide which MPI-rank writes output
-            writeToFile = reduce.hasResult( mpi::reduceMethods::Reduce( ) );
+            m_pipeline = plugins::particleReduction::ParticleReductionPipeline::getInstance(
+                cellDescription
+            );
 
-            // create two ints on gpu and host
-            gEnergy = new GridBuffer<
-                float_64,
-                DIM1
-            >( DataSpace< DIM1 >( 2 ) );
+            // decide which MPI-rank writes output
+            writeToFile = m_pipeline->hasResult( );
 
             // only MPI rank that writes to file
             if( writeToFile )
@@ -497,17 +250,29 @@ namespace picongpu
                     std::cerr << "Error on flushing file [" << filename << "]. " << std::endl;
                 outFile.close( );
             }
-            // free global memory on GPU
-            __delete( gEnergy );
         }
 
         /** this code is executed if the current time step is supposed to compute
          * the energy
+         *
+         * The energy is computed by the particle reduction pipeline together
+         * with all other particle reductions of this step.
          */
         void notify( uint32_t currentStep )
         {
-            // call the method that calls the plugin kernel
-            calculateEnergyParticles < CORE + BORDER > ( currentStep );
+            m_pipeline->requestEnergy< ParticlesType >(
+                m_help->filter.get( m_id ),
+                [ this, currentStep ](
+                    float_64 const *,
+                    float_64 const * reducedEnergy
+                )
+                {
+                    writeEnergy(
+                        currentStep,
+                        reducedEnergy
+                    );
+                }
+            );
         }
 
 
@@ -543,68 +308,17 @@ namespace picongpu
             );
         }
     private:
-        //! method to call analysis and plugin-kernel calls
-        template< uint32_t AREA >
-        void calculateEnergyParticles( uint32_t currentStep )
+        /** write the energies of a step to the output file
+         *
+         * @param currentStep time step of the energies
+         * @param reducedEnergy energies reduced over all ranks
+         *                      (two elements 0 == kinetic; 1 == total energy)
+         */
+        void writeEnergy(
+            uint32_t const currentStep,
+            float_64 const * reducedEnergy
+        )
         {
-            DataConnector &dc = Environment<>::get( ).DataConnector( );
-
-            // use data connector to get particle data
-            auto particles = dc.get< ParticlesType >(
-                ParticlesType::FrameType::getName( ),
-                true
-            );
-
-            // initialize global energies with zero
-            gEnergy->getDeviceBuffer( ).setValue( 0.0 );
-
-            constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
-                pmacc::math::CT::volume< SuperCellSize >::type::value
-            >::value;
-
-            AreaMapping<
-                AREA,
-                MappingDesc
-            > mapper( *m_cellDescription );
-
-            auto kernel = PMACC_KERNEL( KernelEnergyParticles< numWorkers >{ } )(
-                mapper.getGridDim( ),
-                numWorkers
-            );
-            auto binaryKernel = std::bind(
-                kernel,
-                particles->getDeviceParticlesBox( ),
-                gEnergy->getDeviceBuffer( ).getDataBox( ),
-                mapper,
-                std::placeholders::_1
-            );
-
-            ForEach<
-                typename Help::EligibleFilters,
-                plugins::misc::ExecuteIfNameIsEqual< bmpl::_1 >
-            >{ }(
-                m_help->filter.get( m_id ),
-                currentStep,
-                binaryKernel
-            );
-
-            dc.releaseData( ParticlesType::FrameType::getName( ) );
-
-            // get energy from GPU
-            gEnergy->deviceToHost( );
-
-            // create storage for the global reduced result
-            float_64 reducedEnergy[2];
-
-            // add energies from all GPUs using MPI
-            reduce(
-                nvidia::functors::Add( ),
-                reducedEnergy,
-                gEnergy->getHostBuffer( ).getBasePointer( ),
-                2,
-                mpi::reduceMethods::Reduce( )
-            );
-
             /* print timestep, kinetic energy and total energy to file: */
             if( writeToFile )
             {
@@ -618,12 +332,6 @@ namespace picongpu
             }
         }
 
-        //! energy values (global on GPU)
-        GridBuffer<
-            float_64,
-            DIM1
-        > * gEnergy = nullptr;
-
         MappingDesc* m_cellDescription;
 
         //! output file name
@@ -638,8 +346,8 @@ namespace picongpu
          */
         bool writeToFile = false;
 
-        //! MPI reduce to add all energies over several GPUs
-        mpi::MPIReduce reduce;
+        //! computes the energies together with other particle reductions
+        std::shared_ptr< plugins::particleReduction::ParticleReductionPipeline > m_pipeline;
 
         std::shared_ptr< Help > m_help;
         size_t m_id;
@@ -0,0 +1,338 @@
+/* Copyright 2018 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+#include "picongpu/plugins/ILightweightPlugin.hpp"
+#include "picongpu/particles/filter/filter.hpp"
+
+#include <pmacc/Environment.hpp>
+#include <pmacc/mappings/simulation/ResourceMonitor.hpp>
+#include <pmacc/mpi/reduceMethods/Reduce.hpp>
+#include <pmacc/mpi/MPIReduce.hpp>
+#include <pmacc/nvidia/functors/Add.hpp>
+#include <pmacc/nvidia/functors/Max.hpp>
+#include <pmacc/simulationControl/TimeInterval.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace picongpu
+{
+using namespace pmacc;
+
+namespace po = boost::program_options;
+
+    /** suggest a domain decomposition which balances the work between ranks
+     *
+     * The domain decomposition is fixed for the lifetime of a run. This
+     * plugin measures the average wall time per step and estimates the cost
+     * of each rank from its number of macro particles and cells. The rank
+     * costs are projected onto each axis (supercell resolution) and new
+     * subdomain extents are computed which equalize the cost per axis.
+     *
+     * The suggestion is written by rank 0 to `loadBalance.dat` in the
+     * format of the command line option `--gridDist` and can be used to
+     * restart from a checkpoint with a balanced decomposition.
+     */
+    class LoadBalance : public ILightweightPlugin
+    {
+    private:
+        MappingDesc* cellDescription;
+        ResourceMonitor< simDim > resourceMonitor;
+
+        std::string notifyPeriod;
+        //! cost of one cell relative to the cost of one macro particle
+        float_64 cellWeight;
+
+        std::string filename;
+        std::ofstream outFile;
+        //! only rank 0 writes the file
+        bool writeToFile;
+
+        mpi::MPIReduce reduce;
+
+        TimeIntervall stepTimer;
+        uint32_t lastStep;
+
+    public:
+
+        LoadBalance() :
+            cellDescription( nullptr ),
+            cellWeight( 1.0 ),
+            filename( "loadBalance.dat" ),
+            writeToFile( false ),
+            lastStep( 0u )
+        {
+            Environment<>::get().PluginConnector().registerPlugin( this );
+        }
+
+        virtual ~LoadBalance()
+        {
+
+        }
+
+        std::string pluginGetName() const
+        {
+            return "LoadBalance";
+        }
+
+        void pluginRegisterHelp( po::options_description& desc )
+        {
+            desc.add_options()
+                ( "loadBalance.period", po::value< std::string >( &notifyPeriod ),
+                  "suggest a balanced --gridDist [for each n-th step]" )
+                ( "loadBalance.cellWeight", po::value< float_64 >( &cellWeight )->default_value( 1.0 ),
+                  "cost of one cell relative to one macro particle" );
+        }
+
+        void setMappingDescription( MappingDesc* cellDescription )
+        {
+            this->cellDescription = cellDescription;
+        }
+
+        void notify( uint32_t currentStep )
+        {
+            stepTimer.toggleEnd( );
+            float_64 timePerStep = currentStep > lastStep ?
+                stepTimer.getInterval( ) / static_cast< float_64 >( currentStep - lastStep ) :
+                0.0;
+
+            SubGrid< simDim > const & subGrid = Environment< simDim >::get( ).SubGrid( );
+            DataSpace< simDim > const localSize( subGrid.getLocalDomain( ).size );
+            DataSpace< simDim > const localOffset( subGrid.getLocalDomain( ).offset );
+            DataSpace< simDim > const globalSize( subGrid.getGlobalDomain( ).size );
+            DataSpace< simDim > const devices( Environment< simDim >::get( ).GridController( ).getGpuNodes( ) );
+            DataSpace< simDim > const devicePos( Environment< simDim >::get( ).GridController( ).getPosition( ) );
+            DataSpace< simDim > const superCellSize( SuperCellSize::toRT( ) );
+
+            // enforce that the filter interface is fulfilled
+            particles::filter::IUnary< particles::filter::All > parFilter{ currentStep };
+            std::vector< size_t > particleCounts = resourceMonitor.getParticleCounts< VectorAllSpecies >(
+                *cellDescription,
+                parFilter
+            );
+            float_64 const numParticles = std::accumulate(
+                particleCounts.begin( ),
+                particleCounts.end( ),
+                0.0
+            );
+            float_64 localCost = numParticles + cellWeight * static_cast< float_64 >( localSize.productOfComponents( ) );
+
+            float_64 maxCost;
+            float_64 sumCost;
+            float_64 maxTimePerStep;
+            reduce( nvidia::functors::Max( ), &maxCost, &localCost, 1, mpi::reduceMethods::Reduce( ) );
+            reduce( nvidia::functors::Add( ), &sumCost, &localCost, 1, mpi::reduceMethods::Reduce( ) );
+            reduce( nvidia::functors::Max( ), &maxTimePerStep, &timePerStep, 1, mpi::reduceMethods::Reduce( ) );
+
+            std::vector< std::vector< uint32_t > > newExtents( simDim );
+            std::vector< float_64 > oldImbalance( simDim );
+            std::vector< float_64 > newImbalance( simDim );
+            for( uint32_t d = 0; d < simDim; ++d )
+            {
+                uint32_t const numSuperCells = globalSize[ d ] / superCellSize[ d ];
+                uint32_t const firstSuperCell = localOffset[ d ] / superCellSize[ d ];
+                uint32_t const numLocalSuperCells = localSize[ d ] / superCellSize[ d ];
+
+                /* project the cost of this rank onto the axis, the cost is
+                 * assumed to be equally distributed within the local domain
+                 */
+                std::vector< float_64 > localProfile( numSuperCells, 0.0 );
+                for( uint32_t s = 0; s < numLocalSuperCells; ++s )
+                    localProfile[ firstSuperCell + s ] = localCost / static_cast< float_64 >( numLocalSuperCells );
+                std::vector< float_64 > profile( numSuperCells );
+                reduce(
+                    nvidia::functors::Add( ),
+                    profile.data( ),
+                    localProfile.data( ),
+                    numSuperCells,
+                    mpi::reduceMethods::Reduce( )
+                );
+
+                std::vector< uint32_t > localExtents( devices[ d ], 0u );
+                localExtents[ devicePos[ d ] ] = numLocalSuperCells;
+                std::vector< uint32_t > oldExtents( devices[ d ] );
+                reduce(
+                    nvidia::functors::Max( ),
+                    oldExtents.data( ),
+                    localExtents.data( ),
+                    devices[ d ],
+                    mpi::reduceMethods::Reduce( )
+                );
+
+                if( writeToFile )
+                {
+                    uint32_t const minSuperCells = 2u * GuardSize::toRT( )[ d ] + 1u;
+                    newExtents[ d ] = partition( profile, devices[ d ], minSuperCells );
+                    oldImbalance[ d ] = getImbalance( profile, oldExtents );
+                    newImbalance[ d ] = getImbalance( profile, newExtents[ d ] );
+                    for( uint32_t & extent : newExtents[ d ] )
+                        extent *= superCellSize[ d ];
+                }
+            }
+
+            if( writeToFile )
+            {
+                float_64 const avgCost = sumCost / static_cast< float_64 >( devices.productOfComponents( ) );
+                outFile << currentStep << " "
+                    << std::scientific << maxTimePerStep << " "
+                    << ( avgCost > 0.0 ? maxCost / avgCost : 1.0 ) << " ";
+                for( uint32_t d = 0; d < simDim; ++d )
+                    outFile << oldImbalance[ d ] << " " << newImbalance[ d ] << " ";
+                outFile << "--gridDist";
+                for( uint32_t d = 0; d < simDim; ++d )
+                    outFile << " \"" << toGridDistString( newExtents[ d ] ) << "\"";
+                outFile << std::endl;
+            }
+
+            lastStep = currentStep;
+            stepTimer.toggleStart( );
+        }
+
+    private:
+
+        void pluginLoad( )
+        {
+            if( !notifyPeriod.empty( ) )
+            {
+                writeToFile = reduce.hasResult( mpi::reduceMethods::Reduce( ) );
+
+                if( writeToFile )
+                {
+                    outFile.open( filename.c_str( ), std::ofstream::out | std::ostream::trunc );
+                    if( !outFile )
+                    {
+                        std::cerr << "Can't open file [" << filename << "] for output, disable plugin output. " << std::endl;
+                        writeToFile = false;
+                    }
+                    // create header of the file
+                    outFile << "#step maxTimePerStep[msec] rankImbalance";
+                    for( uint32_t d = 0; d < simDim; ++d )
+                        outFile << " imbalance_" << d << " balancedImbalance_" << d;
+                    outFile << " suggestedGridDist" << std::endl;
+                }
+
+                Environment<>::get( ).PluginConnector( ).setNotificationPeriod( this, notifyPeriod );
+                stepTimer.toggleStart( );
+            }
+        }
+
+        void pluginUnload( )
+        {
+            if( writeToFile )
+            {
+                outFile.flush( );
+                if( outFile.fail( ) )
+                    std::cerr << "Error on flushing file [" << filename << "]. " << std::endl;
+                outFile.close( );
+            }
+        }
+
+        /** split a 1D cost profile into blocks with equal cost
+         *
+         * @param profile cost per supercell
+         * @param numBlocks number of blocks
+         * @param minBlockSize minimal number of supercells per block
+         * @return number of supercells per block
+         */
+        static std::vector< uint32_t > partition(
+            std::vector< float_64 > const & profile,
+            uint32_t const numBlocks,
+            uint32_t const minBlockSize
+        )
+        {
+            uint32_t const size = profile.size( );
+            std::vector< float_64 > prefixSum( size + 1u, 0.0 );
+            for( uint32_t s = 0; s < size; ++s )
+                prefixSum[ s + 1u ] = prefixSum[ s ] + profile[ s ];
+
+            std::vector< uint32_t > extents( numBlocks );
+            uint32_t begin = 0u;
+            for( uint32_t b = 0; b + 1u < numBlocks; ++b )
+            {
+                float_64 const target = prefixSum[ size ] * static_cast< float_64 >( b + 1u ) / static_cast< float_64 >( numBlocks );
+                uint32_t end = std::lower_bound( prefixSum.begin( ), prefixSum.end( ), target ) - prefixSum.begin( );
+                // take the closer of both cuts around the target
+                if( end > 0u && target - prefixSum[ end - 1u ] < prefixSum[ std::min( end, size ) ] - target )
+                    --end;
+                // keep enough supercells for this and all following blocks
+                end = std::max( end, begin + minBlockSize );
+                end = std::min( end, size - ( numBlocks - b - 1u ) * minBlockSize );
+                extents[ b ] = end - begin;
+                begin = end;
+            }
+            extents[ numBlocks - 1u ] = size - begin;
+            return extents;
+        }
+
+        //! maximum cost of a block divided by the average cost of all blocks
+        static float_64 getImbalance(
+            std::vector< float_64 > const & profile,
+            std::vector< uint32_t > const & extents
+        )
+        {
+            float_64 maxCost = 0.0;
+            float_64 sumCost = 0.0;
+            uint32_t begin = 0u;
+            for( uint32_t const extent : extents )
+            {
+                float_64 const cost = std::accumulate(
+                    profile.begin( ) + begin,
+                    profile.begin( ) + begin + extent,
+                    0.0
+                );
+                maxCost = std::max( maxCost, cost );
+                sumCost += cost;
+                begin += extent;
+            }
+            float_64 const avgCost = sumCost / static_cast< float_64 >( extents.size( ) );
+            return avgCost > 0.0 ? maxCost / avgCost : 1.0;
+        }
+
+        //! create a `--gridDist` description, e.g. `64,32{2},64`
+        static std::string toGridDistString( std::vector< uint32_t > const & extents )
+        {
+            std::stringstream ss;
+            for( size_t i = 0; i < extents.size( ); )
+            {
+                size_t count = 1u;
+                while( i + count < extents.size( ) && extents[ i + count ] == extents[ i ] )
+                    ++count;
+                if( i != 0u )
+                    ss << ",";
+                ss << extents[ i ];
+                if( count > 1u )
+                    ss << "{" << count << "}";
+                i += count;
+            }
+            return ss.str( );
+        }
+    };
+
+} // namespace picongpu
+
+#include <pmacc/mappings/simulation/ResourceMonitor.tpp>
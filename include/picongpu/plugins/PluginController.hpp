@@ -43,18 +43,17 @@
 #   include "picongpu/plugins/adios/ADIOSWriter.hpp"
 #endif
 
-#if( PMACC_CUDA_ENABLED == 1 )
-#   include "picongpu/plugins/PositionsParticles.hpp"
-#   include "picongpu/plugins/ChargeConservation.hpp"
-#   include "picongpu/plugins/particleMerging/ParticleMerger.hpp"
-#   if(ENABLE_HDF5 == 1)
-#       include "picongpu/plugins/makroParticleCounter/PerSuperCell.hpp"
-#   endif
-
-#   include "picongpu/plugins/SliceFieldPrinterMulti.hpp"
-#   if(SIMDIM==DIM3)
-#       include "picongpu/plugins/IntensityPlugin.hpp"
-#   endif
+#include "picongpu/plugins/PositionsParticles.hpp"
+#include "picongpu/plugins/ChargeConservation.hpp"
+#include "picongpu/plugins/particleMerging/ParticleMerger.hpp"
+#if(ENABLE_HDF5 == 1)
+#   include "picongpu/plugins/makroParticleCounter/PerSuperCell.hpp"
+#endif
+
+#include "picongpu/plugins/SliceFieldPrinterMulti.hpp"
+
+#if( PMACC_CUDA_ENABLED == 1 ) && (SIMDIM==DIM3)
+#   include "picongpu/plugins/IntensityPlugin.hpp"
 #endif
 
 #if (ENABLE_ISAAC == 1) && (SIMDIM==DIM3)
@@ -71,6 +70,7 @@
 
 #include "picongpu/plugins/Checkpoint.hpp"
 #include "picongpu/plugins/ResourceLog.hpp"
+#include "picongpu/plugins/LoadBalance.hpp"
 
 #include <pmacc/mappings/kernel/MappingDescription.hpp>
 
@@ -166,12 +166,10 @@ private:
         , plugins::multi::Master< adios::ADIOSWriter >
 #endif
 
-#if( PMACC_CUDA_ENABLED == 1 )
         , SumCurrents
         , ChargeConservation
-#   if(SIMDIM==DIM3)
+#if( PMACC_CUDA_ENABLED == 1 ) && (SIMDIM==DIM3)
         , IntensityPlugin
-#   endif
 #endif
 
 #if (ENABLE_ISAAC == 1) && (SIMDIM==DIM3)
@@ -182,14 +180,13 @@ private:
         , plugins::multi::Master< hdf5::HDF5Writer >
 #endif
         , ResourceLog
+        , LoadBalance
     >;
 
 
     /* define field plugins */
     using UnspecializedFieldPlugins = bmpl::vector<
-#if( PMACC_CUDA_ENABLED == 1 )
         SliceFieldPrinterMulti< bmpl::_1 >
-#endif
     >;
 
     using AllFields = bmpl::vector< FieldB, FieldE, FieldJ >;
@@ -218,12 +215,10 @@ private:
         , plugins::multi::Master< ParticleCalorimeter<bmpl::_1> >
         , plugins::multi::Master< PhaseSpace<particles::shapes::Counter::ChargeAssignment, bmpl::_1> >
 #endif
-#if( PMACC_CUDA_ENABLED == 1 )
         , PositionsParticles<bmpl::_1>
         , plugins::particleMerging::ParticleMerger<bmpl::_1>
-#   if(ENABLE_HDF5 == 1)
+#if(ENABLE_HDF5 == 1)
         , PerSuperCell<bmpl::_1>
-#   endif
 #endif
     >;
 
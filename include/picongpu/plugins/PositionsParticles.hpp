@@ -26,8 +26,10 @@
 #include "picongpu/particles/traits/SpeciesEligibleForSolver.hpp"
 
 #include <pmacc/mappings/kernel/AreaMapping.hpp>
-#include <pmacc/memory/shared/Allocate.hpp>
 #include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/mappings/threads/ForEachIdx.hpp>
+#include <pmacc/mappings/threads/IdxConfig.hpp>
+#include <pmacc/traits/GetNumWorkers.hpp>
 #include <pmacc/traits/HasIdentifiers.hpp>
 #include <pmacc/traits/HasFlag.hpp>
 
@@ -98,7 +100,10 @@ struct SglParticle
 /** write the position of a single particle to a file
  * \warning this plugin MUST NOT be used with more than one (global!)
  * particle and is created for one-particle-test-purposes only
+ *
+ * @tparam T_numWorkers number of workers
  */
+template< uint32_t T_numWorkers >
 struct KernelPositionsParticles
 {
     template<
@@ -114,60 +119,67 @@ struct KernelPositionsParticles
         Mapping mapper
     ) const
     {
+        using namespace mappings::threads;
 
-        using FramePtr = typename ParBox::FramePtr;
-        PMACC_SMEM( acc, frame, FramePtr );
+        constexpr uint32_t numWorkers = T_numWorkers;
+        constexpr uint32_t numParticlesPerFrame = pmacc::math::CT::volume<
+            typename ParBox::FrameType::SuperCellSize
+        >::type::value;
 
+        uint32_t const workerIdx = threadIdx.x;
 
-        using SuperCellSize = typename Mapping::SuperCellSize;
+        using FramePtr = typename ParBox::FramePtr;
 
-        const DataSpace<simDim > threadIndex(threadIdx);
-        const int linearThreadIdx = DataSpaceOperations<simDim>::template map<SuperCellSize > (threadIndex);
-        const DataSpace<simDim> superCellIdx(mapper.getSuperCellIndex(DataSpace<simDim > (blockIdx)));
+        DataSpace< simDim > const superCellIdx( mapper.getSuperCellIndex(
+            DataSpace< simDim >( blockIdx )
+        ));
 
-        if (linearThreadIdx == 0)
-        {
-            frame = pb.getLastFrame(superCellIdx);
-        }
+        // each virtual worker is traversing the frame list on its own
+        FramePtr frame = pb.getLastFrame( superCellIdx );
 
-        __syncthreads();
-        if (!frame.isValid())
-            return; //end kernel if we have no frames
+        using ParticleDomCfg = IdxConfig<
+            numParticlesPerFrame,
+            numWorkers
+        >;
 
-        /* BUGFIX to issue #538
-         * volatile prohibits that the compiler creates wrong code*/
-        volatile bool isParticle = frame[linearThreadIdx][multiMask_];
+        ForEachIdx< ParticleDomCfg > forEachParticle( workerIdx );
 
-        while (frame.isValid())
+        while( frame.isValid( ) )
         {
-            if (isParticle)
-            {
-                auto particle = frame[linearThreadIdx];
-                gParticle->position = particle[position_];
-                gParticle->momentum = particle[momentum_];
-                gParticle->weighting = particle[weighting_];
-                gParticle->mass = attribute::getMass(gParticle->weighting,particle);
-                gParticle->charge = attribute::getCharge(gParticle->weighting,particle);
-                gParticle->gamma = Gamma<>()(gParticle->momentum, gParticle->mass);
-
-                // storage number in the actual frame
-                const lcellId_t frameCellNr = particle[localCellIdx_];
-
-                // offset in the actual superCell = cell offset in the supercell
-                const DataSpace<simDim> frameCellOffset(DataSpaceOperations<simDim>::template map<MappingDesc::SuperCellSize > (frameCellNr));
-
-
-                gParticle->globalCellOffset = (superCellIdx - mapper.getGuardingSuperCells())
-                    * MappingDesc::SuperCellSize::toRT()
-                    + frameCellOffset;
-            }
-            __syncthreads();
-            if (linearThreadIdx == 0)
-            {
-                frame = pb.getPreviousFrame(frame);
-            }
-            isParticle = true;
-            __syncthreads();
+            forEachParticle(
+                [&](
+                    uint32_t const linearIdx,
+                    uint32_t const
+                )
+                {
+                    auto particle = frame[ linearIdx ];
+                    /* only the last frame can contain gaps, all other
+                     * frames are filled with valid particles
+                     */
+                    if( particle[ multiMask_ ] == 1 )
+                    {
+                        gParticle->position = particle[position_];
+                        gParticle->momentum = particle[momentum_];
+                        gParticle->weighting = particle[weighting_];
+                        gParticle->mass = attribute::getMass(gParticle->weighting,particle);
+                        gParticle->charge = attribute::getCharge(gParticle->weighting,particle);
+                        gParticle->gamma = Gamma<>()(gParticle->momentum, gParticle->mass);
+
+                        // storage number in the actual frame
+                        const lcellId_t frameCellNr = particle[localCellIdx_];
+
+                        // offset in the actual superCell = cell offset in the supercell
+                        const DataSpace<simDim> frameCellOffset(DataSpaceOperations<simDim>::template map<MappingDesc::SuperCellSize > (frameCellNr));
+
+
+                        gParticle->globalCellOffset = (superCellIdx - mapper.getGuardingSuperCells())
+                            * MappingDesc::SuperCellSize::toRT()
+                            + frameCellOffset;
+                    }
+                }
+            );
+
+            frame = pb.getPreviousFrame( frame );
         }
 
     }
@@ -261,11 +273,14 @@ private:
         auto particles = dc.get< ParticlesType >( ParticlesType::FrameType::getName(), true );
 
         gParticle->getDeviceBuffer().setValue(positionParticleTmp);
-        auto block = SuperCellSize::toRT();
+
+        constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+            pmacc::math::CT::volume< SuperCellSize >::type::value
+        >::value;
 
         AreaMapping<AREA, MappingDesc> mapper(*cellDescription);
-        PMACC_KERNEL(KernelPositionsParticles{})
-            (mapper.getGridDim(), block)
+        PMACC_KERNEL(KernelPositionsParticles< numWorkers >{})
+            (mapper.getGridDim(), numWorkers)
             (particles->getDeviceParticlesBox(),
              gParticle->getDeviceBuffer().getBasePointer(),
              mapper);
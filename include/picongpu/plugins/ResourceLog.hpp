@@ -24,6 +24,7 @@
 // pmacc
 #include <pmacc/Environment.hpp>
 #include <pmacc/mappings/simulation/ResourceMonitor.hpp>
+#include <pmacc/simulationControl/PhaseTimer.hpp>
 
 // PIConGPU
 #include "picongpu/plugins/ILightweightPlugin.hpp"
@@ -44,6 +45,8 @@
 #include <sstream>   /* std::stringstream */
 #include <fstream>   /* std::filebuf */
 #include <map>       /* std::map */
+#include <vector>    /* std::vector */
+#include <algorithm> /* std::max */
 
 // C LIB
 #include <stdlib.h> /* itoa */
@@ -141,6 +144,11 @@ namespace picongpu
                 pt.put("resourceLog.particleCount", std::accumulate(particleCounts.begin(), particleCounts.end(), 0));
             }
 
+            if(contains(propertyMap, "phaseTimes"))
+            {
+                putPhaseTimes(pt);
+            }
+
             //
             // Write property tree to string stream
             std::stringstream ss;
@@ -197,7 +205,7 @@ namespace picongpu
                     ("resourceLog.stream", po::value<std::string>(&streamType)->default_value("file"),
                      "Output stream [stdout, stderr, file]")
                     ("resourceLog.properties", po::value<std::vector<std::string> >(&properties)->multitoken(),
-                     "List of properties to log [rank, position, currentStep, cellCount, particleCount]")
+                     "List of properties to log [rank, position, currentStep, cellCount, particleCount, phaseTimes]")
                     ("resourceLog.format", po::value<std::string>(&outputFormat)->default_value("json"),
                      "Output format of log (pp for pretty print) [json, jsonpp, xml, xmlpp]");
         }
@@ -233,6 +241,13 @@ namespace picongpu
                     }
                 }
 
+                /* timing the phases of a step synchronizes the simulation,
+                 * therefore the timers are only enabled on request
+                 */
+                if (contains(propertyMap, "phaseTimes")) {
+                    PhaseTimer::getInstance().setEnabled(true);
+                }
+
                 // Prepare file for output stream
                 if (streamType == "file") {
                     size_t rank = static_cast<size_t>(Environment<simDim>::get().GridController().getGlobalRank());
@@ -252,6 +267,58 @@ namespace picongpu
             /* called when plugin is unloaded, cleanup here */
         }
 
+        /** add the time per step of each phase since the last log
+         *
+         * The minimum, maximum and average over all ranks are reported in
+         * milliseconds, all ranks must call this method.
+         */
+        void putPhaseTimes(boost::property_tree::ptree & pt)
+        {
+            PhaseTimer & phaseTimer = PhaseTimer::getInstance();
+            std::map<std::string, double> const & times = phaseTimer.getTimes();
+            double const numSteps = std::max(phaseTimer.getNumSteps(), 1u);
+
+            std::vector<double> localTimes;
+            for (auto const & time : times)
+                localTimes.push_back(time.second / numSteps);
+
+            GridController<simDim>& gc = Environment<simDim>::get().GridController();
+            MPI_Comm comm = gc.getCommunicator().getMPIComm();
+
+            // avoid deadlock between not finished pmacc tasks and mpi blocking collectives
+            __getTransactionEvent().waitForFinished();
+
+            // all ranks must have timed the same phases to reduce them element-wise
+            int const numPhases = static_cast<int>(localTimes.size());
+            int minNumPhases = 0;
+            int maxNumPhases = 0;
+            MPI_CHECK(MPI_Allreduce(&numPhases, &minNumPhases, 1, MPI_INT, MPI_MIN, comm));
+            MPI_CHECK(MPI_Allreduce(&numPhases, &maxNumPhases, 1, MPI_INT, MPI_MAX, comm));
+            if (minNumPhases != maxNumPhases)
+                throw std::runtime_error("ResourceLog: number of timed phases differs between ranks");
+
+            std::vector<double> minTimes(localTimes.size());
+            std::vector<double> maxTimes(localTimes.size());
+            std::vector<double> sumTimes(localTimes.size());
+            MPI_CHECK(MPI_Allreduce(localTimes.data(), minTimes.data(), numPhases, MPI_DOUBLE, MPI_MIN, comm));
+            MPI_CHECK(MPI_Allreduce(localTimes.data(), maxTimes.data(), numPhases, MPI_DOUBLE, MPI_MAX, comm));
+            MPI_CHECK(MPI_Allreduce(localTimes.data(), sumTimes.data(), numPhases, MPI_DOUBLE, MPI_SUM, comm));
+
+            pt.put("resourceLog.phaseTimes.steps", phaseTimer.getNumSteps());
+            size_t i = 0;
+            for (auto const & time : times)
+            {
+                std::string const path = std::string("resourceLog.phaseTimes.") + time.first;
+                pt.put(path + ".local", localTimes[i]);
+                pt.put(path + ".min", minTimes[i]);
+                pt.put(path + ".max", maxTimes[i]);
+                pt.put(path + ".avg", sumTimes[i] / static_cast<double>(gc.getGlobalSize()));
+                ++i;
+            }
+
+            phaseTimer.reset();
+        }
+
         template <typename T_MAP>
         bool contains(T_MAP const map, std::string const value)
         {
@@ -31,7 +31,6 @@
 #include <pmacc/cuSTL/container/DeviceBuffer.hpp>
 #include <pmacc/cuSTL/container/HostBuffer.hpp>
 #include <pmacc/cuSTL/cursor/tools/slice.hpp>
-#include <pmacc/cuSTL/algorithm/kernel/Foreach.hpp>
 #include <pmacc/cuSTL/algorithm/host/Foreach.hpp>
 #include "SliceFieldPrinterMulti.hpp"
 #include <sstream>
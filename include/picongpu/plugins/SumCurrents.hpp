@@ -29,6 +29,10 @@
 #include <pmacc/memory/shared/Allocate.hpp>
 #include <pmacc/dataManagement/DataConnector.hpp>
 #include <pmacc/nvidia/atomic.hpp>
+#include <pmacc/mappings/kernel/AreaMapping.hpp>
+#include <pmacc/mappings/threads/ForEachIdx.hpp>
+#include <pmacc/mappings/threads/IdxConfig.hpp>
+#include <pmacc/traits/GetNumWorkers.hpp>
 
 #include <iostream>
 
@@ -41,6 +45,11 @@ namespace po = boost::program_options;
 
 using J_DataBox = FieldJ::DataBoxType;
 
+/** sum the current density of all cells
+ *
+ * @tparam T_numWorkers number of workers
+ */
+template< uint32_t T_numWorkers >
 struct KernelSumCurrents
 {
     template<
@@ -54,38 +63,78 @@ struct KernelSumCurrents
         Mapping mapper
     ) const
     {
+        using namespace mappings::threads;
         using SuperCellSize = typename Mapping::SuperCellSize;
 
+        constexpr uint32_t numWorkers = T_numWorkers;
+        constexpr uint32_t cellsPerSuperCell = pmacc::math::CT::volume< SuperCellSize >::type::value;
+
+        uint32_t const workerIdx = threadIdx.x;
+
         PMACC_SMEM( acc, sh_sumJ, float3_X );
 
-        const DataSpace<simDim > threadIndex(threadIdx);
-        const int linearThreadIdx = DataSpaceOperations<simDim>::template map<SuperCellSize > (threadIndex);
+        using MasterOnly = IdxConfig<
+            1,
+            numWorkers
+        >;
 
-        if (linearThreadIdx == 0)
-        {
-            sh_sumJ = float3_X::create(0.0);
-        }
+        ForEachIdx< MasterOnly > onlyMaster{ workerIdx };
+
+        onlyMaster(
+            [&](
+                uint32_t const,
+                uint32_t const
+            )
+            {
+                sh_sumJ = float3_X::create(0.0);
+            }
+        );
 
         __syncthreads();
 
 
         const DataSpace<simDim> superCellIdx(mapper.getSuperCellIndex(DataSpace<simDim > (blockIdx)));
-        const DataSpace<simDim> cell(superCellIdx * SuperCellSize::toRT() + threadIndex);
-
-        const float3_X myJ = fieldJ(cell);
 
-        atomicAdd( &(sh_sumJ.x()), myJ.x(), ::alpaka::hierarchy::Threads{});
-        atomicAdd( &(sh_sumJ.y()), myJ.y(), ::alpaka::hierarchy::Threads{});
-        atomicAdd( &(sh_sumJ.z()), myJ.z(), ::alpaka::hierarchy::Threads{});
+        // sum the current of all cells touched by the virtual worker
+        float3_X localJ = float3_X::create(0.0);
+
+        ForEachIdx<
+            IdxConfig<
+                cellsPerSuperCell,
+                numWorkers
+            >
+        >{ workerIdx }(
+            [&](
+                uint32_t const linearIdx,
+                uint32_t const
+            )
+            {
+                const DataSpace<simDim> cellIdx(
+                    DataSpaceOperations<simDim>::template map<SuperCellSize>(linearIdx)
+                );
+                const DataSpace<simDim> cell(superCellIdx * SuperCellSize::toRT() + cellIdx);
+
+                localJ += fieldJ(cell);
+            }
+        );
+
+        atomicAdd( &(sh_sumJ.x()), localJ.x(), ::alpaka::hierarchy::Threads{});
+        atomicAdd( &(sh_sumJ.y()), localJ.y(), ::alpaka::hierarchy::Threads{});
+        atomicAdd( &(sh_sumJ.z()), localJ.z(), ::alpaka::hierarchy::Threads{});
 
         __syncthreads();
 
-        if (linearThreadIdx == 0)
-        {
-            atomicAdd( &(gCurrent->x()), sh_sumJ.x(), ::alpaka::hierarchy::Blocks{});
-            atomicAdd( &(gCurrent->y()), sh_sumJ.y(), ::alpaka::hierarchy::Blocks{});
-            atomicAdd( &(gCurrent->z()), sh_sumJ.z(), ::alpaka::hierarchy::Blocks{});
-        }
+        onlyMaster(
+            [&](
+                uint32_t const,
+                uint32_t const
+            )
+            {
+                atomicAdd( &(gCurrent->x()), sh_sumJ.x(), ::alpaka::hierarchy::Blocks{});
+                atomicAdd( &(gCurrent->y()), sh_sumJ.y(), ::alpaka::hierarchy::Blocks{});
+                atomicAdd( &(gCurrent->z()), sh_sumJ.z(), ::alpaka::hierarchy::Blocks{});
+            }
+        );
     }
 };
 
@@ -186,11 +235,14 @@ private:
         auto fieldJ = dc.get< FieldJ >( FieldJ::getName(), true );
 
         sumcurrents->getDeviceBuffer().setValue(float3_X::create(0.0));
-        auto block = MappingDesc::SuperCellSize::toRT();
+
+        constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+            pmacc::math::CT::volume< MappingDesc::SuperCellSize >::type::value
+        >::value;
 
         AreaMapping<CORE + BORDER, MappingDesc> mapper(*cellDescription);
-        PMACC_KERNEL(KernelSumCurrents{})
-            (mapper.getGridDim(), block)
+        PMACC_KERNEL(KernelSumCurrents< numWorkers >{})
+            (mapper.getGridDim(), numWorkers)
             (fieldJ->getDeviceDataBox(),
              sumcurrents->getDeviceBuffer().getBasePointer(),
              mapper);
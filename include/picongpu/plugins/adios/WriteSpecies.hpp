@@ -27,6 +27,7 @@
 #include "picongpu/plugins/ISimulationPlugin.hpp"
 
 #include "picongpu/plugins/output/WriteSpeciesCommon.hpp"
+#include "picongpu/plugins/output/ParticleStagingArena.hpp"
 #include "picongpu/plugins/adios/writer/ParticleAttribute.hpp"
 
 #include <pmacc/compileTime/conversion/MakeSeq.hpp>
@@ -50,6 +51,8 @@
 #include <boost/type_traits.hpp>
 #include <boost/type_traits/is_same.hpp>
 
+#include <algorithm>
+#include <limits>
 
 namespace picongpu
 {
@@ -98,64 +101,56 @@ public:
         /* load particle without copy particle data to host */
         auto speciesTmp = dc.get< ThisSpecies >( ThisSpecies::FrameType::getName(), true );
 
-        /* count total number of particles on the device */
-        log<picLog::INPUT_OUTPUT > ("ADIOS:   (begin) count particles: %1%") % T_SpeciesFilter::getName();
         // enforce that the filter interface is fulfilled
         particles::filter::IUnary< typename T_SpeciesFilter::Filter > particleFilter{ params->currentStep };
-        uint64_cu totalNumParticles = 0;
-        totalNumParticles = pmacc::CountParticles::countOnDevice < CORE + BORDER > (
-                                                                                    *speciesTmp,
-                                                                                    *(params->cellDescription),
-                                                                                    params->localWindowToDomainOffset,
-                                                                                    params->window.localDimensions.size,
-                                                                                    particleFilter);
-        log<picLog::INPUT_OUTPUT > ("ADIOS:   ( end ) count particles: %1% = %2%") % T_SpeciesFilter::getName() % totalNumParticles;
-
-        AdiosFrameType hostFrame;
 
-        /* malloc host memory */
-        log<picLog::INPUT_OUTPUT > ("ADIOS:   (begin) malloc host memory: %1%") % T_SpeciesFilter::getName();
-        ForEach<typename AdiosFrameType::ValueTypeSeq, MallocHostMemory<bmpl::_1> > mallocMem;
-        mallocMem(forward(hostFrame), totalNumParticles);
-        log<picLog::INPUT_OUTPUT > ("ADIOS:   ( end ) malloc host memory: %1%") % T_SpeciesFilter::getName();
+        typedef bmpl::vector< typename GetPositionFilter<simDim>::type > usedFilters;
+        typedef typename FilterFactory<usedFilters>::FilterType MyParticleFilter;
+        MyParticleFilter filter;
+        /* activate filter pipeline if moving window is activated */
+        filter.setStatus(MovingWindow::getInstance().isSlidingWindowActive());
+        filter.setWindowPosition(params->localWindowToDomainOffset,
+                                 params->window.localDimensions.size);
 
-        if (totalNumParticles > 0)
-        {
-            log<picLog::INPUT_OUTPUT > ("ADIOS:   (begin) copy particle host (with hierarchy) to host (without hierarchy): %1%") % T_SpeciesFilter::getName();
-            typedef bmpl::vector< typename GetPositionFilter<simDim>::type > usedFilters;
-            typedef typename FilterFactory<usedFilters>::FilterType MyParticleFilter;
-            MyParticleFilter filter;
-            /* activate filter pipeline if moving window is activated */
-            filter.setStatus(MovingWindow::getInstance().isSlidingWindowActive());
-            filter.setWindowPosition(params->localWindowToDomainOffset,
-                                     params->window.localDimensions.size);
-
-            DataConnector &dc = Environment<>::get().DataConnector();
 #if( PMACC_CUDA_ENABLED == 1 )
-            auto mallocMCBuffer = dc.get< MallocMCBuffer< DeviceHeap > >( MallocMCBuffer< DeviceHeap >::getName(), true );
+        auto mallocMCBuffer = dc.get< MallocMCBuffer< DeviceHeap > >( MallocMCBuffer< DeviceHeap >::getName(), true );
+        auto particlesBox = speciesTmp->getHostParticlesBox( mallocMCBuffer->getOffset() );
+#else
+        /* This separate code path is only a workaround until MallocMCBuffer
+         * is alpaka compatible.
+         *
+         * @todo remove this workaround: we know that we are allowed to access the
+         * device memory directly.
+         */
+        auto particlesBox = speciesTmp->getDeviceParticlesBox( );
+        /* Notify to the event system that the particles box is used on the host.
+         *
+         * @todo remove this workaround
+         */
+        __startOperation(ITask::TASK_HOST);
 #endif
-            int globalParticleOffset = 0;
-            AreaMapping < CORE + BORDER, MappingDesc > mapper(*(params->cellDescription));
-
-            pmacc::particles::operations::ConcatListOfFrames<simDim> concatListOfFrames(mapper.getGridDim());
+        AreaMapping < CORE + BORDER, MappingDesc > mapper(*(params->cellDescription));
+        pmacc::particles::operations::ConcatListOfFrames<simDim> concatListOfFrames(mapper.getGridDim());
+
+        /* Particles are counted while they are copied into the reused
+         * staging arena. Only if the arena is too small, it is resized and
+         * the copy is repeated.
+         */
+        ParticleStagingArena& stagingArena = params->particleStagingArena;
+        AdiosFrameType hostFrame;
+        AdiosFrameType deviceFrame;
+        uint64_cu totalNumParticles = 0;
 
-#if( PMACC_CUDA_ENABLED == 1 )
-            auto particlesBox = speciesTmp->getHostParticlesBox( mallocMCBuffer->getOffset() );
-#else
-            /* This separate code path is only a workaround until MallocMCBuffer
-             * is alpaka compatible.
-             *
-             * @todo remove this workaround: we know that we are allowed to access the
-             * device memory directly.
-             */
-            auto particlesBox = speciesTmp->getDeviceParticlesBox( );
-            /* Notify to the event system that the particles box is used on the host.
-             *
-             * @todo remove this workaround
-             */
-             __startOperation(ITask::TASK_HOST);
+        log<picLog::INPUT_OUTPUT > ("ADIOS:   (begin) copy particle host (with hierarchy) to host (without hierarchy): %1%") % T_SpeciesFilter::getName();
+        while (true)
+        {
+            const size_t capacity = std::min(
+                stagingArena.getNumParticles< AdiosFrameType >(),
+                size_t(std::numeric_limits<int>::max())
+            );
+            stagingArena.mapFrames(hostFrame, deviceFrame, capacity);
 
-#endif
+            int globalParticleOffset = 0;
             concatListOfFrames(
                                 globalParticleOffset,
                                 hostFrame,
@@ -164,21 +159,29 @@ public:
                                 particleOffset, /*relative to data domain (not to physical domain)*/
                                 totalCellIdx_,
                                 mapper,
-                                particleFilter
+                                particleFilter,
+                                int(capacity)
                                 );
+
+            totalNumParticles = uint64_cu(globalParticleOffset);
+            if (totalNumParticles <= capacity)
+                break;
+
+            /* grow with headroom, the number of particles usually increases between dumps */
+            stagingArena.reserve< AdiosFrameType >(totalNumParticles + totalNumParticles / 8u);
+            log<picLog::INPUT_OUTPUT > ("ADIOS:   resize staging arena to %1% bytes for %2% particles: %3%") %
+                stagingArena.getNumBytes() % totalNumParticles % T_SpeciesFilter::getName();
+        }
 #if( PMACC_CUDA_ENABLED == 1 )
-            dc.releaseData( MallocMCBuffer< DeviceHeap >::getName() );
+        dc.releaseData( MallocMCBuffer< DeviceHeap >::getName() );
 #endif
-            /* this costs a little bit of time but adios writing is slower */
-            PMACC_ASSERT((uint64_cu) globalParticleOffset == totalNumParticles);
-        }
+        log<picLog::INPUT_OUTPUT > ("ADIOS:   ( end ) copy particle host (with hierarchy) to host (without hierarchy): %1% = %2%") %
+            T_SpeciesFilter::getName() % totalNumParticles;
+
         /* dump to adios file */
         ForEach<typename AdiosFrameType::ValueTypeSeq, adios::ParticleAttribute<bmpl::_1> > writeToAdios;
         writeToAdios(params, forward(hostFrame), totalNumParticles);
 
-        /* free host memory */
-        ForEach<typename AdiosFrameType::ValueTypeSeq, FreeHostMemory<bmpl::_1> > freeMem;
-        freeMem(forward(hostFrame));
         log<picLog::INPUT_OUTPUT > ("ADIOS: ( end ) writing species: %1%") % T_SpeciesFilter::getName();
 
         /* write species counter table to adios file */
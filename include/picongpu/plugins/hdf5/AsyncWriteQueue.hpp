@@ -0,0 +1,159 @@
+/* Copyright 2018 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+
+namespace picongpu
+{
+
+namespace hdf5
+{
+
+/** bounded job queue processed by one background I/O thread
+ *
+ * push() blocks as long as maxPending jobs are queued or in progress,
+ * which limits the host memory held by staged dumps.
+ * An exception thrown by a job is re-thrown by the next call to push()
+ * or waitForAll() on the calling thread.
+ */
+class AsyncWriteQueue
+{
+public:
+
+    using Job = std::function< void() >;
+
+    /** constructor
+     *
+     * @param maxPending maximum number of queued and running jobs, must be > 0
+     */
+    explicit AsyncWriteQueue(uint32_t maxPending) :
+        m_maxPending(maxPending > 0u ? maxPending : 1u),
+        m_numPending(0u),
+        m_stop(false),
+        m_thread(&AsyncWriteQueue::run, this)
+    {
+    }
+
+    ~AsyncWriteQueue()
+    {
+        {
+            std::unique_lock< std::mutex > lock(m_mutex);
+            m_jobDone.wait(lock, [this]{ return m_numPending == 0u; });
+            m_stop = true;
+        }
+        m_jobAdded.notify_one();
+        m_thread.join();
+    }
+
+    /** enqueue a job
+     *
+     * @return true if the caller had to wait for a free queue slot
+     */
+    bool push(Job job)
+    {
+        bool hasWaited = false;
+        {
+            std::unique_lock< std::mutex > lock(m_mutex);
+            if (m_numPending >= m_maxPending)
+            {
+                hasWaited = true;
+                m_jobDone.wait(lock, [this]{ return m_numPending < m_maxPending; });
+            }
+            rethrowError();
+            m_jobs.push_back(std::move(job));
+            ++m_numPending;
+        }
+        m_jobAdded.notify_one();
+        return hasWaited;
+    }
+
+    //! block until all queued jobs are finished
+    void waitForAll()
+    {
+        std::unique_lock< std::mutex > lock(m_mutex);
+        m_jobDone.wait(lock, [this]{ return m_numPending == 0u; });
+        rethrowError();
+    }
+
+private:
+
+    void run()
+    {
+        std::unique_lock< std::mutex > lock(m_mutex);
+        while (true)
+        {
+            m_jobAdded.wait(lock, [this]{ return m_stop || !m_jobs.empty(); });
+            if (m_jobs.empty())
+                return;
+
+            Job job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+
+            lock.unlock();
+            std::exception_ptr error;
+            try
+            {
+                job();
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            lock.lock();
+
+            if (error && !m_error)
+                m_error = error;
+            --m_numPending;
+            m_jobDone.notify_all();
+        }
+    }
+
+    //! must be called with locked mutex
+    void rethrowError()
+    {
+        if (m_error)
+        {
+            std::exception_ptr error = m_error;
+            m_error = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    uint32_t const m_maxPending;
+    uint32_t m_numPending;
+    bool m_stop;
+    std::exception_ptr m_error;
+    std::deque< Job > m_jobs;
+    std::mutex m_mutex;
+    std::condition_variable m_jobAdded;
+    std::condition_variable m_jobDone;
+    std::thread m_thread;
+};
+
+} //namespace hdf5
+} //namespace picongpu
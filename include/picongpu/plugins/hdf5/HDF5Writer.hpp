@@ -27,10 +27,13 @@
 #include <list>
 #include <vector>
 #include <regex>
+#include <memory>
+#include <chrono>
 
 #include "picongpu/simulation_defines.hpp"
 
 #include "picongpu/plugins/hdf5/HDF5Writer.def"
+#include "picongpu/plugins/hdf5/AsyncWriteQueue.hpp"
 #include "picongpu/traits/SplashToPIC.hpp"
 #include "picongpu/traits/PICToSplash.hpp"
 #include "picongpu/plugins/misc/misc.hpp"
@@ -137,6 +140,13 @@ public:
             "HDF5 output filename (prefix)"
         };
 
+        plugins::multi::Option< uint32_t > asyncQueueDepth = {
+            "asyncQueueDepth",
+            "number of dumps staged in host memory and written by a background I/O thread, "
+            "0 writes blocking",
+            0u
+        };
+
         /** defines if the plugin must register itself to the PMacc plugin system
          *
          * true = the plugin is registering it self
@@ -220,6 +230,21 @@ public:
                 desc,
                 masterPrefix + prefix
             );
+            /* the background I/O thread needs MPI_THREAD_MULTIPLE, which
+             * must be requested before MPI is initialized
+             */
+            asyncQueueDepth.setNotifier(
+                []( std::vector< uint32_t > const & queueDepths )
+                {
+                    for( uint32_t const queueDepth : queueDepths )
+                        if( queueDepth > 0u )
+                            Environment<>::get().requireMpiThreadLevel( MPI_THREAD_MULTIPLE );
+                }
+            );
+            asyncQueueDepth.registerHelp(
+                desc,
+                masterPrefix + prefix
+            );
             selfRegister = true;
 
         }
@@ -319,6 +344,7 @@ public:
         mThreadParams.cellDescription = m_cellDescription;
 
         GridController<simDim> &gc = Environment<simDim>::get().GridController();
+        ioComm = gc.getCommunicator().getMPIComm();
 
         /* It is important that we never change the mpi_pos after this point
          * because we get problems with the restart.
@@ -347,16 +373,37 @@ public:
 
                 /** create notify directory */
                 Environment<simDim>::get().Filesystem().createDirectoryWithPermissions(outputDirectory);
+
+                uint32_t const queueDepth = m_help->asyncQueueDepth.get( id );
+                if( queueDepth > 0u )
+                    initAsyncIO( queueDepth );
             }
         }
     }
 
     virtual ~HDF5Writer()
     {
+        /* finish all staged dumps before the file handles are released */
+        if( ioQueue )
+        {
+            try
+            {
+                ioQueue->waitForAll();
+            }
+            catch( const std::exception& e )
+            {
+                std::cerr << "HDF5Writer: asynchronous write failed: " << e.what() << std::endl;
+            }
+            ioQueue.reset();
+        }
+
         if (mThreadParams.dataCollector)
                 mThreadParams.dataCollector->finalize();
 
          __delete(mThreadParams.dataCollector);
+
+        if( ioComm != Environment<simDim>::get().GridController().getCommunicator().getMPIComm() )
+            MPI_CHECK(MPI_Comm_free(&ioComm));
     }
 
     void notify(uint32_t currentStep)
@@ -414,11 +461,11 @@ public:
 
         const uint32_t maxOpenFilesPerNode = 4;
         GridController<simDim> &gc = Environment<simDim>::get().GridController();
-        mThreadParams.dataCollector = new ParallelDomainCollector(
-                                                                  gc.getCommunicator().getMPIComm(),
-                                                                  gc.getCommunicator().getMPIInfo(),
-                                                                  splashMpiSize,
-                                                                  maxOpenFilesPerNode);
+        mThreadParams.dataCollector = new StagedDomainCollector(
+                                                                gc.getCommunicator().getMPIComm(),
+                                                                gc.getCommunicator().getMPIInfo(),
+                                                                splashMpiSize,
+                                                                maxOpenFilesPerNode);
 
         mThreadParams.currentStep = restartStep;
 
@@ -522,6 +569,43 @@ public:
 
 private:
 
+    /** enable writing dumps from a background I/O thread
+     *
+     * The libSplash calls of a dump are staged in host memory and issued on
+     * a duplicated communicator by the I/O thread while the simulation
+     * continues. MPI_THREAD_MULTIPLE is requested while parsing
+     * --hdf5.asyncQueueDepth. Without a thread-safe HDF5 library dumps are
+     * written blocking.
+     *
+     * @param queueDepth maximum number of dumps in flight
+     */
+    void initAsyncIO(uint32_t const queueDepth)
+    {
+        GridController<simDim> &gc = Environment<simDim>::get().GridController();
+
+        int mpiThreadLevel = MPI_THREAD_SINGLE;
+        MPI_CHECK(MPI_Query_thread(&mpiThreadLevel));
+        hbool_t isHDF5ThreadSafe = 0;
+        H5is_library_threadsafe(&isHDF5ThreadSafe);
+
+        if( mpiThreadLevel < MPI_THREAD_MULTIPLE || !isHDF5ThreadSafe )
+        {
+            if( gc.getGlobalRank() == 0 )
+                std::cerr << "HDF5Writer: asynchronous output requires MPI_THREAD_MULTIPLE "
+                          << "and a thread-safe HDF5 library, dumps are written blocking"
+                          << std::endl;
+            return;
+        }
+
+        /* collective HDF5 calls of the I/O thread must never interleave with
+         * MPI calls of the simulation on the same communicator
+         */
+        MPI_CHECK(MPI_Comm_dup(gc.getCommunicator().getMPIComm(), &ioComm));
+        ioQueue.reset( new AsyncWriteQueue( queueDepth ) );
+
+        log<picLog::INPUT_OUTPUT > ("HDF5: asynchronous output with %1% dump(s) in flight") % queueDepth;
+    }
+
     void closeH5File()
     {
         if (mThreadParams.dataCollector != nullptr)
@@ -537,11 +621,11 @@ private:
         if (mThreadParams.dataCollector == nullptr)
         {
             GridController<simDim> &gc = Environment<simDim>::get().GridController();
-            mThreadParams.dataCollector = new ParallelDomainCollector(
-                                                                      gc.getCommunicator().getMPIComm(),
-                                                                      gc.getCommunicator().getMPIInfo(),
-                                                                      splashMpiSize,
-                                                                      maxOpenFilesPerNode);
+            mThreadParams.dataCollector = new StagedDomainCollector(
+                                                                    ioComm,
+                                                                    gc.getCommunicator().getMPIInfo(),
+                                                                    splashMpiSize,
+                                                                    maxOpenFilesPerNode);
         }
         // set attributes for datacollector files
         DataCollector::FileCreationAttr attr;
@@ -585,6 +669,12 @@ private:
             }
         }
 
+        if( ioQueue && !mThreadParams.isCheckpoint )
+        {
+            dumpDataAsync();
+            return;
+        }
+
         openH5File(mThreadParams.h5Filename);
 
         writeHDF5((void*) &mThreadParams);
@@ -592,6 +682,58 @@ private:
         closeH5File();
     }
 
+    /** stage a dump in host memory and hand it to the I/O thread
+     *
+     * All data is copied from the device and all MPI reductions of the
+     * writers are done before this method returns, the I/O thread only
+     * issues the recorded libSplash calls.
+     */
+    void dumpDataAsync()
+    {
+        /* the collector must exist before the I/O thread can use it */
+        if (mThreadParams.dataCollector == nullptr)
+        {
+            const uint32_t maxOpenFilesPerNode = 4;
+            GridController<simDim> &gc = Environment<simDim>::get().GridController();
+            mThreadParams.dataCollector = new StagedDomainCollector(
+                                                                    ioComm,
+                                                                    gc.getCommunicator().getMPIInfo(),
+                                                                    splashMpiSize,
+                                                                    maxOpenFilesPerNode);
+        }
+
+        std::shared_ptr< StagedDomainCollector::Staging > staging(
+            new StagedDomainCollector::Staging
+        );
+
+        mThreadParams.dataCollector->beginStaging(*staging);
+        writeHDF5((void*) &mThreadParams);
+        mThreadParams.dataCollector->endStaging();
+
+        log<picLog::INPUT_OUTPUT > ("HDF5: staged %1% bytes for file: %2%") %
+            staging->stagedBytes % mThreadParams.h5Filename;
+
+        const std::string h5Filename = mThreadParams.h5Filename;
+        const auto start = std::chrono::steady_clock::now();
+        const bool hasWaited = ioQueue->push(
+            [this, staging, h5Filename]()
+            {
+                openH5File(h5Filename);
+                mThreadParams.dataCollector->replay(*staging);
+                closeH5File();
+            }
+        );
+
+        if( hasWaited )
+        {
+            const auto stall = std::chrono::duration_cast< std::chrono::milliseconds >(
+                std::chrono::steady_clock::now() - start
+            );
+            log<picLog::INPUT_OUTPUT > ("HDF5: I/O thread behind, waited %1% ms for a free staging slot") %
+                stall.count();
+        }
+    }
+
     template< typename T_ParticleFilter>
     struct CallWriteSpecies
     {
@@ -758,6 +900,12 @@ private:
 
     ThreadParams mThreadParams;
 
+    //! background I/O thread, only set for asynchronous output
+    std::unique_ptr< AsyncWriteQueue > ioQueue;
+
+    //! communicator used by libSplash
+    MPI_Comm ioComm;
+
     std::shared_ptr< Help > m_help;
     size_t m_id;
 
@@ -0,0 +1,379 @@
+/* Copyright 2018 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <splash/splash.h>
+#include <hdf5.h>
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace picongpu
+{
+
+namespace hdf5
+{
+
+using namespace splash;
+
+/** libSplash collection type holding a private copy of another HDF5 type
+ *
+ * Staged writes outlive the collection type objects the writers create on
+ * their stack, therefore the HDF5 type is duplicated.
+ */
+class StagedColType : public CollectionType
+{
+public:
+
+    StagedColType(const CollectionType& other)
+    {
+        this->type = H5Tcopy(other.getDataType());
+    }
+
+    virtual ~StagedColType()
+    {
+        H5Tclose(this->type);
+    }
+
+    size_t getSize() const
+    {
+        return H5Tget_size(this->type);
+    }
+
+    std::string toString() const
+    {
+        return "StagedColType";
+    }
+
+private:
+
+    StagedColType(const StagedColType&);
+    StagedColType& operator=(const StagedColType&);
+};
+
+/** ParallelDomainCollector which can stage writes in host memory
+ *
+ * While a staging area is attached with beginStaging(), all write calls
+ * used by the HDF5 writers are recorded together with a copy of their
+ * source buffers instead of being passed to HDF5. The recorded calls are
+ * issued later with replay(), e.g. from a background I/O thread, between
+ * open() and close() of the target file.
+ *
+ * Without an attached staging area all calls are forwarded directly.
+ */
+class StagedDomainCollector : public ParallelDomainCollector
+{
+public:
+
+    /** one recorded libSplash write call */
+    struct Record
+    {
+        enum Kind
+        {
+            Attribute,
+            AttributeND,
+            GlobalAttribute,
+            GlobalAttributeND,
+            Write,
+            WriteDomain
+        };
+
+        Kind kind;
+        int32_t id;
+        std::shared_ptr< StagedColType > type;
+        /* dataName of attributes can be nullptr for global attributes */
+        bool hasDataName;
+        std::string dataName;
+        std::string attrName;
+        uint32_t ndims;
+        Dimensions dims;
+        Dimensions globalSize;
+        Dimensions globalOffset;
+        splash::Selection select;
+        splash::Domain globalDomain;
+        DomainCollector::DomDataClass dataClass;
+        std::vector< char > payload;
+
+        Record(Kind k, int32_t i, const CollectionType& t) :
+            kind(k),
+            id(i),
+            type(new StagedColType(t)),
+            hasDataName(false),
+            ndims(0),
+            select(Dimensions(1, 1, 1)),
+            dataClass(DomainCollector::GridType)
+        {
+        }
+    };
+
+    /** all write calls of one file */
+    struct Staging
+    {
+        std::vector< Record > records;
+
+        /** host memory held by the staged source buffers in bytes */
+        size_t stagedBytes = 0;
+    };
+
+    StagedDomainCollector(
+        MPI_Comm comm,
+        MPI_Info info,
+        const Dimensions topology,
+        uint32_t maxFileHandles
+    ) :
+        ParallelDomainCollector(comm, info, topology, maxFileHandles),
+        m_staging(nullptr)
+    {
+    }
+
+    /** record all following write calls into staging */
+    void beginStaging(Staging& staging)
+    {
+        m_staging = &staging;
+    }
+
+    /** forward all following write calls directly to libSplash */
+    void endStaging()
+    {
+        m_staging = nullptr;
+    }
+
+    /** issue all recorded calls to the currently opened file */
+    void replay(const Staging& staging)
+    {
+        for (const Record& r : staging.records)
+        {
+            const char* dataName = r.hasDataName ? r.dataName.c_str() : nullptr;
+            const void* buf = r.payload.data();
+            switch (r.kind)
+            {
+            case Record::Attribute:
+                ParallelDomainCollector::writeAttribute(r.id, *r.type, dataName,
+                                                        r.attrName.c_str(), buf);
+                break;
+            case Record::AttributeND:
+                ParallelDomainCollector::writeAttribute(r.id, *r.type, dataName,
+                                                        r.attrName.c_str(),
+                                                        r.ndims, r.dims, buf);
+                break;
+            case Record::GlobalAttribute:
+                ParallelDomainCollector::writeGlobalAttribute(r.id, *r.type,
+                                                              r.attrName.c_str(), buf);
+                break;
+            case Record::GlobalAttributeND:
+                ParallelDomainCollector::writeGlobalAttribute(r.id, *r.type,
+                                                              r.attrName.c_str(),
+                                                              r.ndims, r.dims, buf);
+                break;
+            case Record::Write:
+                ParallelDomainCollector::write(r.id, r.globalSize, r.globalOffset,
+                                               *r.type, r.ndims, r.select,
+                                               dataName, buf);
+                break;
+            case Record::WriteDomain:
+                ParallelDomainCollector::writeDomain(r.id, r.globalSize, r.globalOffset,
+                                                     *r.type, r.ndims, r.select,
+                                                     dataName, r.globalDomain,
+                                                     r.dataClass, buf);
+                break;
+            }
+        }
+    }
+
+    using ParallelDomainCollector::writeAttribute;
+    using ParallelDomainCollector::writeGlobalAttribute;
+    using ParallelDomainCollector::write;
+    using ParallelDomainCollector::writeDomain;
+
+    void writeAttribute(int32_t id,
+                        const CollectionType& type,
+                        const char *dataName,
+                        const char *attrName,
+                        const void *buf)
+    {
+        if (m_staging == nullptr)
+        {
+            ParallelDomainCollector::writeAttribute(id, type, dataName, attrName, buf);
+            return;
+        }
+
+        Record r(Record::Attribute, id, type);
+        setDataName(r, dataName);
+        r.attrName = attrName;
+        stage(r, buf, 1u);
+    }
+
+    void writeAttribute(int32_t id,
+                        const CollectionType& type,
+                        const char *dataName,
+                        const char *attrName,
+                        uint32_t ndims,
+                        const Dimensions dims,
+                        const void *buf)
+    {
+        if (m_staging == nullptr)
+        {
+            ParallelDomainCollector::writeAttribute(id, type, dataName, attrName,
+                                                    ndims, dims, buf);
+            return;
+        }
+
+        Record r(Record::AttributeND, id, type);
+        setDataName(r, dataName);
+        r.attrName = attrName;
+        r.ndims = ndims;
+        r.dims = dims;
+        stage(r, buf, numElements(dims, ndims));
+    }
+
+    void writeGlobalAttribute(int32_t id,
+                              const CollectionType& type,
+                              const char *name,
+                              const void *buf)
+    {
+        if (m_staging == nullptr)
+        {
+            ParallelDomainCollector::writeGlobalAttribute(id, type, name, buf);
+            return;
+        }
+
+        Record r(Record::GlobalAttribute, id, type);
+        r.attrName = name;
+        stage(r, buf, 1u);
+    }
+
+    void writeGlobalAttribute(int32_t id,
+                              const CollectionType& type,
+                              const char *name,
+                              uint32_t ndims,
+                              const Dimensions dims,
+                              const void *buf)
+    {
+        if (m_staging == nullptr)
+        {
+            ParallelDomainCollector::writeGlobalAttribute(id, type, name,
+                                                          ndims, dims, buf);
+            return;
+        }
+
+        Record r(Record::GlobalAttributeND, id, type);
+        r.attrName = name;
+        r.ndims = ndims;
+        r.dims = dims;
+        stage(r, buf, numElements(dims, ndims));
+    }
+
+    void write(int32_t id,
+               const Dimensions globalSize,
+               const Dimensions globalOffset,
+               const CollectionType& type,
+               uint32_t ndims,
+               const splash::Selection select,
+               const char* name,
+               const void* buf)
+    {
+        if (m_staging == nullptr)
+        {
+            ParallelDomainCollector::write(id, globalSize, globalOffset, type,
+                                           ndims, select, name, buf);
+            return;
+        }
+
+        Record r(Record::Write, id, type);
+        setDataName(r, name);
+        r.ndims = ndims;
+        r.globalSize = globalSize;
+        r.globalOffset = globalOffset;
+        r.select = select;
+        stage(r, buf, numElements(select.size, ndims));
+    }
+
+    void writeDomain(int32_t id,
+                     const Dimensions globalSize,
+                     const Dimensions globalOffset,
+                     const CollectionType& type,
+                     uint32_t ndims,
+                     const splash::Selection select,
+                     const char* name,
+                     const splash::Domain globalDomain,
+                     DomainCollector::DomDataClass dataClass,
+                     const void* buf)
+    {
+        if (m_staging == nullptr)
+        {
+            ParallelDomainCollector::writeDomain(id, globalSize, globalOffset, type,
+                                                 ndims, select, name, globalDomain,
+                                                 dataClass, buf);
+            return;
+        }
+
+        Record r(Record::WriteDomain, id, type);
+        setDataName(r, name);
+        r.ndims = ndims;
+        r.globalSize = globalSize;
+        r.globalOffset = globalOffset;
+        r.select = select;
+        r.globalDomain = globalDomain;
+        r.dataClass = dataClass;
+        stage(r, buf, numElements(select.size, ndims));
+    }
+
+private:
+
+    static size_t numElements(const Dimensions& size, uint32_t ndims)
+    {
+        size_t n = 1;
+        for (uint32_t d = 0; d < ndims; ++d)
+            n *= size[d];
+        return n;
+    }
+
+    static void setDataName(Record& r, const char* name)
+    {
+        r.hasDataName = (name != nullptr);
+        if (r.hasDataName)
+            r.dataName = name;
+    }
+
+    /** copy the source buffer and append the record to the staging area */
+    void stage(Record& r, const void* buf, size_t elements)
+    {
+        if (H5Tis_variable_str(r.type->getDataType()) > 0)
+            throw std::runtime_error("HDF5: variable length strings can not be staged");
+
+        const size_t bytes = r.type->getSize() * elements;
+        /* libSplash expects a valid pointer even if this rank writes no data */
+        r.payload.resize(bytes > 0 ? bytes : 1u);
+        if (bytes > 0)
+            std::memcpy(r.payload.data(), buf, bytes);
+
+        m_staging->stagedBytes += bytes;
+        m_staging->records.push_back(std::move(r));
+    }
+
+    Staging* m_staging;
+};
+
+} //namespace hdf5
+} //namespace picongpu
@@ -61,7 +61,7 @@ namespace writeMeta
          * @param currentStep current simulation time step
          */
         void operator()(
-            ParallelDomainCollector* dc,
+            StagedDomainCollector* dc,
             const std::string& meshesPath,
             const uint32_t currentStep
         ) const
@@ -112,7 +112,7 @@ namespace writeMeta
          * @param currentStep current simulation time step
          */
         void operator()(
-            ParallelDomainCollector* /* dc */,
+            StagedDomainCollector* /* dc */,
             const std::string& /* meshesPath */,
             const uint32_t /* currentStep */
         ) const
@@ -133,7 +133,7 @@ namespace writeMeta
             ColTypeDouble ctDouble;
             SplashFloatXType splashFloatXType;
 
-            ParallelDomainCollector *dc = threadParams->dataCollector;
+            StagedDomainCollector *dc = threadParams->dataCollector;
             uint32_t currentStep = threadParams->currentStep;
 
             /* openPMD attributes */
@@ -25,6 +25,7 @@
 #include "picongpu/traits/PICToOpenPMD.hpp"
 #include "picongpu/plugins/ISimulationPlugin.hpp"
 #include "picongpu/plugins/output/WriteSpeciesCommon.hpp"
+#include "picongpu/plugins/output/ParticleStagingArena.hpp"
 #include "picongpu/plugins/kernel/CopySpecies.kernel"
 #include "picongpu/particles/traits/GetSpeciesFlagName.hpp"
 #include "picongpu/plugins/hdf5/writer/ParticleAttribute.hpp"
@@ -47,6 +48,8 @@
 #include <boost/mpl/find.hpp>
 #include <boost/type_traits.hpp>
 
+#include <algorithm>
+#include <limits>
 #include <string>
 #include <type_traits>
 
@@ -168,66 +171,50 @@ public:
         /* load particle without copy particle data to host */
         auto speciesTmp = dc.get< ThisSpecies >( ThisSpecies::FrameType::getName(), true );
 
-        /* count number of particles for this species on the device */
-        uint64_t numParticles = 0;
-
-        log<picLog::INPUT_OUTPUT > ("HDF5:  (begin) count particles: %1%") % T_SpeciesFilter::getName();
-
         // enforce that the filter interface is fulfilled
         particles::filter::IUnary< typename T_SpeciesFilter::Filter > particleFilter{ params->currentStep };
-        /* at this point we cast to uint64_t, before we assume that per device
-         * less then 1e9 (int range) particles will be counted
-         */
-        numParticles = uint64_t( pmacc::CountParticles::countOnDevice< CORE + BORDER >(
-            *speciesTmp,
-            *(params->cellDescription),
-            params->localWindowToDomainOffset,
-            params->window.localDimensions.size,
-            particleFilter
-        ));
 
-
-        log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) count particles: %1% = %2%") % T_SpeciesFilter::getName() % numParticles;
+        typedef bmpl::vector< typename GetPositionFilter<simDim>::type > usedFilters;
+        typedef typename FilterFactory<usedFilters>::FilterType MyParticleFilter;
+        MyParticleFilter filter;
+        /* activate filter pipeline if moving window is activated */
+        filter.setStatus(MovingWindow::getInstance().isSlidingWindowActive());
+        filter.setWindowPosition(params->localWindowToDomainOffset,
+                                 params->window.localDimensions.size);
+
+        /* int: assume < 2e9 particles per device */
+        GridBuffer<int, DIM1> counterBuffer(DataSpace<DIM1>(1));
+        AreaMapping < CORE + BORDER, MappingDesc > mapper(*(params->cellDescription));
+
+        constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+            pmacc::math::CT::volume< SuperCellSize >::type::value
+        >::value;
+
+        /* Particles are counted while they are copied into the reused
+         * staging arena. Only if the arena is too small, it is resized and
+         * the copy is repeated.
+         */
+        ParticleStagingArena& stagingArena = params->particleStagingArena;
         Hdf5FrameType hostFrame;
-        log<picLog::INPUT_OUTPUT > ("HDF5:  (begin) malloc mapped memory: %1%") % T_SpeciesFilter::getName();
-        /*malloc mapped memory*/
-        ForEach<typename Hdf5FrameType::ValueTypeSeq, MallocMemory<bmpl::_1> > mallocMem;
-        mallocMem(forward(hostFrame), numParticles);
-        log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) malloc mapped memory: %1%") % T_SpeciesFilter::getName();
+        Hdf5FrameType deviceFrame;
+        uint64_t numParticles = 0;
 
-        if (numParticles != 0)
+        log<picLog::INPUT_OUTPUT > ("HDF5:  (begin) copy particle to host: %1%") % T_SpeciesFilter::getName();
+        while (true)
         {
+            const size_t capacity = std::min(
+                stagingArena.getNumParticles< Hdf5FrameType >(),
+                size_t(std::numeric_limits<int>::max())
+            );
+            stagingArena.mapFrames(hostFrame, deviceFrame, capacity);
 
-            log<picLog::INPUT_OUTPUT > ("HDF5:  (begin) get mapped memory device pointer: %1%") % T_SpeciesFilter::getName();
-            /*load device pointer of mapped memory*/
-            Hdf5FrameType deviceFrame;
-            ForEach<typename Hdf5FrameType::ValueTypeSeq, GetDevicePtr<bmpl::_1> > getDevicePtr;
-            getDevicePtr(forward(deviceFrame), forward(hostFrame));
-            log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) get mapped memory device pointer: %1%") % T_SpeciesFilter::getName();
-
-            log<picLog::INPUT_OUTPUT > ("HDF5:  (begin) copy particle to host: %1%") % T_SpeciesFilter::getName();
-            typedef bmpl::vector< typename GetPositionFilter<simDim>::type > usedFilters;
-            typedef typename FilterFactory<usedFilters>::FilterType MyParticleFilter;
-            MyParticleFilter filter;
-            /* activate filter pipeline if moving window is activated */
-            filter.setStatus(MovingWindow::getInstance().isSlidingWindowActive());
-            filter.setWindowPosition(params->localWindowToDomainOffset,
-                                     params->window.localDimensions.size);
-
-            /* int: assume < 2e9 particles per device */
-            GridBuffer<int, DIM1> counterBuffer(DataSpace<DIM1>(1));
-            AreaMapping < CORE + BORDER, MappingDesc > mapper(*(params->cellDescription));
-
-            constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
-                pmacc::math::CT::volume< SuperCellSize >::type::value
-            >::value;
-
-            /* this sanity check costs a little bit of time but hdf5 writing is slower */
+            counterBuffer.getDeviceBuffer().setValue(0);
             PMACC_KERNEL( CopySpecies< numWorkers >{} )(
                 mapper.getGridDim(),
                 numWorkers
             )(
                 counterBuffer.getDeviceBuffer().getPointer(),
+                int(capacity),
                 deviceFrame, speciesTmp->getDeviceParticlesBox(),
                 filter,
                 domainOffset,
@@ -236,12 +223,18 @@ public:
                 particleFilter
             );
             counterBuffer.deviceToHost();
-            log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) copy particle to host: %1%") % T_SpeciesFilter::getName();
             __getTransactionEvent().waitForFinished();
-            log<picLog::INPUT_OUTPUT > ("HDF5:  all events are finished: %1%") % T_SpeciesFilter::getName();
 
-            PMACC_ASSERT((uint64_t) counterBuffer.getHostBuffer().getDataBox()[0] == numParticles);
+            numParticles = uint64_t(counterBuffer.getHostBuffer().getDataBox()[0]);
+            if (numParticles <= capacity)
+                break;
+
+            /* grow with headroom, the number of particles usually increases between dumps */
+            stagingArena.reserve< Hdf5FrameType >(numParticles + numParticles / 8u);
+            log<picLog::INPUT_OUTPUT > ("HDF5:  resize staging arena to %1% bytes for %2% particles: %3%") %
+                stagingArena.getNumBytes() % numParticles % T_SpeciesFilter::getName();
         }
+        log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) copy particle to host: %1% = %2%") % T_SpeciesFilter::getName() % numParticles;
 
         /* We rather do an allgather at this point then letting libSplash
          * do an allgather during write to find out the global number of
@@ -507,9 +500,6 @@ public:
 
         log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) writing particlePatches for %1%") % T_SpeciesFilter::getName();
 
-        /*free host memory*/
-        ForEach<typename Hdf5FrameType::ValueTypeSeq, FreeMemory<bmpl::_1> > freeMem;
-        freeMem(forward(hostFrame));
         log<picLog::INPUT_OUTPUT > ("HDF5: ( end ) writing species: %1%") % T_SpeciesFilter::getName();
     }
 
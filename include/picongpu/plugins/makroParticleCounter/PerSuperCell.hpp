@@ -28,6 +28,10 @@
 #include <pmacc/memory/buffers/GridBuffer.hpp>
 #include <pmacc/memory/shared/Allocate.hpp>
 #include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/mappings/threads/ForEachIdx.hpp>
+#include <pmacc/mappings/threads/IdxConfig.hpp>
+#include <pmacc/traits/GetNumWorkers.hpp>
+#include <pmacc/nvidia/atomic.hpp>
 
 #include <splash/splash.h>
 
@@ -42,6 +46,11 @@ namespace picongpu
 using namespace pmacc;
 using namespace splash;
 
+/** count the makro particles of each supercell
+ *
+ * @tparam T_numWorkers number of workers
+ */
+template< uint32_t T_numWorkers >
 struct CountMakroParticle
 {
     template<
@@ -57,53 +66,82 @@ struct CountMakroParticle
         Mapping mapper
     ) const
     {
+        using namespace mappings::threads;
 
         typedef MappingDesc::SuperCellSize SuperCellSize;
-        typedef typename ParBox::FrameType FrameType;
         typedef typename ParBox::FramePtr FramePtr;
 
+        constexpr uint32_t numWorkers = T_numWorkers;
+        constexpr uint32_t numParticlesPerFrame = pmacc::math::CT::volume< SuperCellSize >::type::value;
+
+        uint32_t const workerIdx = threadIdx.x;
+
         const DataSpace<simDim> block(mapper.getSuperCellIndex(DataSpace<simDim > (blockIdx)));
         /* counterBox has no guarding supercells*/
         const DataSpace<simDim> counterCell = block - mapper.getGuardingSuperCells();
 
-        const DataSpace<simDim > threadIndex(threadIdx);
-        const int linearThreadIdx = DataSpaceOperations<simDim>::template map<SuperCellSize > (threadIndex);
-
         PMACC_SMEM( acc, counterValue, uint64_cu );
-        PMACC_SMEM( acc, frame, FramePtr );
 
-        if (linearThreadIdx == 0)
-        {
-            counterValue = 0;
-            frame = parBox.getLastFrame(block);
-            if (!frame.isValid())
+        using MasterOnly = IdxConfig<
+            1,
+            numWorkers
+        >;
+
+        ForEachIdx< MasterOnly > onlyMaster{ workerIdx };
+
+        onlyMaster(
+            [&](
+                uint32_t const,
+                uint32_t const
+            )
             {
-                counterBox(counterCell) = counterValue;
+                counterValue = 0;
             }
-        }
+        );
+
         __syncthreads();
-        if (!frame.isValid())
-            return; //end kernel if we have no frames
 
-        bool isParticle = frame[linearThreadIdx][multiMask_];
+        // each virtual worker is traversing the frame list on its own
+        FramePtr frame = parBox.getLastFrame(block);
+
+        // number of particles touched by the virtual worker
+        uint64_cu localCounter = 0;
+
+        ForEachIdx<
+            IdxConfig<
+                numParticlesPerFrame,
+                numWorkers
+            >
+        > forEachParticle( workerIdx );
 
         while (frame.isValid())
         {
-            if (isParticle)
-            {
-                atomicAdd(&counterValue, static_cast<uint64_cu> (1LU), ::alpaka::hierarchy::Blocks{});
-            }
-            __syncthreads();
-            if (linearThreadIdx == 0)
-            {
-                frame = parBox.getPreviousFrame(frame);
-            }
-            isParticle = true;
-            __syncthreads();
+            forEachParticle(
+                [&](
+                    uint32_t const linearIdx,
+                    uint32_t const
+                )
+                {
+                    if( frame[ linearIdx ][ multiMask_ ] == 1 )
+                        ++localCounter;
+                }
+            );
+            frame = parBox.getPreviousFrame(frame);
         }
 
-        if (linearThreadIdx == 0)
-            counterBox(counterCell) = counterValue;
+        atomicAdd(&counterValue, localCounter, ::alpaka::hierarchy::Threads{});
+
+        __syncthreads();
+
+        onlyMaster(
+            [&](
+                uint32_t const,
+                uint32_t const
+            )
+            {
+                counterBox(counterCell) = counterValue;
+            }
+        );
     }
 };
 /** Count makro particle of a species and write down the result to a global HDF5 file.
@@ -219,8 +257,12 @@ private:
         typedef MappingDesc::SuperCellSize SuperCellSize;
         AreaMapping<AREA, MappingDesc> mapper(*cellDescription);
 
-        PMACC_KERNEL(CountMakroParticle{})
-            (mapper.getGridDim(), SuperCellSize::toRT())
+        constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+            pmacc::math::CT::volume< SuperCellSize >::type::value
+        >::value;
+
+        PMACC_KERNEL(CountMakroParticle< numWorkers >{})
+            (mapper.getGridDim(), numWorkers)
             (particles->getDeviceParticlesBox(),
              localResult->getDeviceBuffer().getDataBox(), mapper);
 
@@ -23,6 +23,7 @@
 #include <exception>
 #include <string>
 #include <sstream>
+#include <functional>
 
 
 namespace picongpu
@@ -115,13 +116,29 @@ namespace multi
             if( m_hasDefaultValue )
                 printDefault = std::string( " | default: " ) + getDefaultAsStr();
 
+            auto * value = boost::program_options::value( getStorage() )->multitoken( );
+            if( m_notifier )
+                value->notifier( m_notifier );
+
             desc.add_options( )(
                 ( prefix + "." + getName() ).c_str( ),
-                boost::program_options::value( getStorage() )->multitoken( ),
+                value,
                 ( getDescription() + additionalDescription + printDefault ).c_str()
             );
         }
 
+        /** set a function called with the user values after parsing
+         *
+         * Must be set before registerHelp() is called. The function is not
+         * called if the user did not set the option.
+         *
+         * @param notifier function called with all values set by the user
+         */
+        void setNotifier( std::function< void( StorageType const & ) > const & notifier )
+        {
+            m_notifier = notifier;
+        }
+
         /** get the default value
          *
          * Throw an exception if there is no default value defined.
@@ -184,6 +201,8 @@ namespace multi
         T_ValueType m_defaultValue;
         bool m_hasDefaultValue = false;
 
+        std::function< void( StorageType const & ) > m_notifier;
+
         StorageType* getStorage()
         {
             return static_cast<StorageType*>(this);
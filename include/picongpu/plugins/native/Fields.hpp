@@ -0,0 +1,110 @@
+/* Copyright 2018 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+#include "picongpu/plugins/native/NativeWriter.def"
+
+#include <pmacc/dataManagement/DataConnector.hpp>
+
+#include <string>
+
+
+namespace picongpu
+{
+
+namespace native
+{
+using namespace pmacc;
+
+namespace detail
+{
+    //! name of the record of a field buffer
+    template< typename T_Field >
+    std::string getFieldRecordName()
+    {
+        return std::string( "fields/" ) + T_Field::getName();
+    }
+
+    //! number of bytes of a field buffer including the guard
+    template< typename T_Field >
+    uint64_t getFieldNumBytes( T_Field & field )
+    {
+        return uint64_t( field.getGridBuffer().getHostBuffer().getDataSpace().productOfComponents() ) *
+            sizeof( typename T_Field::ValueType );
+    }
+} // namespace detail
+
+/** Write the buffer of a field including the guard to a checkpoint file
+ *
+ * @tparam T_Field field class to write
+ */
+template< typename T_Field >
+struct WriteFields
+{
+    HINLINE void operator()(ThreadParams* params)
+    {
+        DataConnector &dc = Environment<>::get().DataConnector();
+
+        /* load field without copying data to host */
+        auto field = dc.get< T_Field >( T_Field::getName(), true );
+        field->getGridBuffer().deviceToHost();
+        __getTransactionEvent().waitForFinished();
+
+        log<picLog::INPUT_OUTPUT > ("native: write field: %1%") % T_Field::getName();
+        params->file.write(
+            detail::getFieldRecordName< T_Field >(),
+            field->getGridBuffer().getHostBuffer().getBasePointer(),
+            detail::getFieldNumBytes( *field )
+        );
+
+        dc.releaseData( T_Field::getName() );
+    }
+};
+
+/** Load the buffer of a field including the guard from a checkpoint file
+ *
+ * @tparam T_Field field class to load
+ */
+template< typename T_Field >
+struct LoadFields
+{
+    HINLINE void operator()(ThreadParams* params)
+    {
+        DataConnector &dc = Environment<>::get().DataConnector();
+
+        /* load field without copying data to host */
+        auto field = dc.get< T_Field >( T_Field::getName(), true );
+
+        log<picLog::INPUT_OUTPUT > ("native: load field: %1%") % T_Field::getName();
+        params->file.read(
+            detail::getFieldRecordName< T_Field >(),
+            field->getGridBuffer().getHostBuffer().getBasePointer(),
+            detail::getFieldNumBytes( *field )
+        );
+        field->getGridBuffer().hostToDevice();
+        __getTransactionEvent().waitForFinished();
+
+        dc.releaseData( T_Field::getName() );
+    }
+};
+
+} //namespace native
+} //namespace picongpu
@@ -0,0 +1,420 @@
+/* Copyright 2018 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace picongpu
+{
+namespace native
+{
+
+    /** binary checkpoint file of a single MPI rank
+     *
+     * Layout:
+     *   - header (one alignment block): magic, version, time step and the
+     *     location of the index
+     *   - records: raw bytes, each record starts at a multiple of `alignment`
+     *     and is written with as few `pwrite` calls as possible
+     *   - index: name, offset and size of each record
+     *
+     * The header is written last, a file of an interrupted checkpoint is
+     * therefore rejected during the restart.
+     */
+    class CheckpointFile
+    {
+    public:
+
+        //! byte alignment of the header, each record and the index
+        static constexpr uint64_t alignment = 4096u;
+
+        //! format version, increase if the layout of a record changes
+        static constexpr uint32_t version = 1u;
+
+        CheckpointFile() = default;
+
+        CheckpointFile( CheckpointFile const & ) = delete;
+        CheckpointFile & operator=( CheckpointFile const & ) = delete;
+
+        ~CheckpointFile()
+        {
+            release();
+        }
+
+        /** create a file and truncate an existing one
+         *
+         * @param fileName path to the file
+         * @param currentStep time step stored in the header
+         */
+        void create(
+            std::string const & fileName,
+            uint32_t const currentStep
+        )
+        {
+            release();
+            m_fileName = fileName;
+            m_step = currentStep;
+            m_isWritable = true;
+            m_fd = ::open(
+                fileName.c_str(),
+                O_WRONLY | O_CREAT | O_TRUNC,
+                S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH
+            );
+            if( m_fd < 0 )
+                throwError( "can not create file" );
+            // the header is written by close()
+            m_offset = alignment;
+        }
+
+        /** open a file for reading and load the index
+         *
+         * @param fileName path to the file
+         * @param restartStep time step which must match the header
+         * @param useMmap true to map the file into memory instead of reading
+         *                each record with `pread`
+         */
+        void open(
+            std::string const & fileName,
+            uint32_t const restartStep,
+            bool const useMmap
+        )
+        {
+            release();
+            m_fileName = fileName;
+            m_isWritable = false;
+            m_fd = ::open( fileName.c_str(), O_RDONLY );
+            if( m_fd < 0 )
+                throwError( "can not open file" );
+
+            struct stat fileStat;
+            if( ::fstat( m_fd, &fileStat ) != 0 )
+                throwError( "can not query the file size" );
+            m_fileSize = uint64_t( fileStat.st_size );
+
+            if( useMmap && m_fileSize != 0u )
+            {
+                void * mapped = ::mmap( nullptr, m_fileSize, PROT_READ, MAP_PRIVATE, m_fd, 0 );
+                if( mapped == MAP_FAILED )
+                    throwError( "can not map file into memory" );
+                m_mapped = static_cast< char * >( mapped );
+                ::madvise( mapped, m_fileSize, MADV_SEQUENTIAL );
+            }
+
+            Header header;
+            readBytes( &header, sizeof( header ), 0u );
+            if( std::memcmp( header.magic, magic(), sizeof( header.magic ) ) != 0 )
+                throw std::runtime_error(
+                    m_fileName + ": not a native checkpoint file or checkpoint is incomplete"
+                );
+            if( header.version != version )
+                throw std::runtime_error(
+                    m_fileName + ": unsupported format version " + std::to_string( header.version )
+                );
+            if( header.step != restartStep )
+                throw std::runtime_error(
+                    m_fileName + ": contains time step " + std::to_string( header.step ) +
+                    " but the restart step is " + std::to_string( restartStep )
+                );
+            m_step = header.step;
+
+            std::vector< char > index( header.indexSize );
+            readBytes( index.data(), header.indexSize, header.indexOffset );
+            char const * pos = index.data();
+            char const * const end = pos + index.size();
+            for( uint64_t i = 0u; i < header.numRecords; ++i )
+            {
+                uint64_t nameLength = 0u;
+                Record record;
+                if( pos + sizeof( nameLength ) > end )
+                    throw std::runtime_error( m_fileName + ": index is corrupted" );
+                std::memcpy( &nameLength, pos, sizeof( nameLength ) );
+                pos += sizeof( nameLength );
+                if( pos + nameLength + 2u * sizeof( uint64_t ) > end )
+                    throw std::runtime_error( m_fileName + ": index is corrupted" );
+                std::string const name( pos, nameLength );
+                pos += nameLength;
+                std::memcpy( &record.offset, pos, sizeof( record.offset ) );
+                pos += sizeof( record.offset );
+                std::memcpy( &record.size, pos, sizeof( record.size ) );
+                pos += sizeof( record.size );
+                m_records[ name ] = record;
+            }
+        }
+
+        /** append a record
+         *
+         * @param name unique name of the record
+         * @param data pointer to the record, can be nullptr if numBytes is zero
+         * @param numBytes size of the record in bytes
+         */
+        void write(
+            std::string const & name,
+            void const * data,
+            uint64_t const numBytes
+        )
+        {
+            if( !m_isWritable )
+                throw std::runtime_error( m_fileName + ": file is not opened for writing" );
+            if( m_records.find( name ) != m_records.end( ) )
+                throw std::runtime_error( m_fileName + ": record '" + name + "' is written twice" );
+
+            writeBytes( data, numBytes, m_offset );
+            m_records[ name ] = Record{ m_offset, numBytes };
+            m_offset = alignUp( m_offset + numBytes );
+        }
+
+        //! append a record with a single value
+        template< typename T_Value >
+        void writeValue(
+            std::string const & name,
+            T_Value const & value
+        )
+        {
+            write( name, &value, sizeof( T_Value ) );
+        }
+
+        //! size of a record in bytes
+        uint64_t getSize( std::string const & name ) const
+        {
+            return findRecord( name ).size;
+        }
+
+        /** copy a record into memory
+         *
+         * @param name name of the record
+         * @param data destination
+         * @param numBytes size of the destination, must be equal to the size of the record
+         */
+        void read(
+            std::string const & name,
+            void * data,
+            uint64_t const numBytes
+        ) const
+        {
+            Record const & record = findRecord( name );
+            if( record.size != numBytes )
+                throw std::runtime_error(
+                    m_fileName + ": record '" + name + "' has " + std::to_string( record.size ) +
+                    " bytes but " + std::to_string( numBytes ) + " bytes are expected"
+                );
+            readBytes( data, numBytes, record.offset );
+        }
+
+        //! read a record with a single value
+        template< typename T_Value >
+        T_Value readValue( std::string const & name ) const
+        {
+            T_Value value;
+            read( name, &value, sizeof( T_Value ) );
+            return value;
+        }
+
+        /** write the index and the header and close the file
+         *
+         * A file opened for reading is only closed.
+         */
+        void close()
+        {
+            if( m_isWritable && m_fd >= 0 )
+            {
+                std::vector< char > index;
+                for( auto const & record : m_records )
+                {
+                    uint64_t const nameLength = record.first.size();
+                    appendBytes( index, &nameLength, sizeof( nameLength ) );
+                    appendBytes( index, record.first.data(), nameLength );
+                    appendBytes( index, &record.second.offset, sizeof( record.second.offset ) );
+                    appendBytes( index, &record.second.size, sizeof( record.second.size ) );
+                }
+                writeBytes( index.data(), index.size(), m_offset );
+
+                Header header;
+                std::memset( &header, 0, sizeof( header ) );
+                std::memcpy( header.magic, magic(), sizeof( header.magic ) );
+                header.version = version;
+                header.step = m_step;
+                header.indexOffset = m_offset;
+                header.indexSize = index.size();
+                header.numRecords = m_records.size();
+
+                /* the index and all records must be on the disk before the
+                 * header marks the checkpoint as complete
+                 */
+                if( ::fsync( m_fd ) != 0 )
+                    throwError( "can not flush file" );
+                writeBytes( &header, sizeof( header ), 0u );
+                if( ::fsync( m_fd ) != 0 )
+                    throwError( "can not flush file" );
+            }
+            release();
+        }
+
+        //! true if the file is mapped into memory
+        bool isMapped() const
+        {
+            return m_mapped != nullptr;
+        }
+
+    private:
+
+        struct Header
+        {
+            char magic[ 8 ];
+            uint32_t version;
+            uint32_t step;
+            uint64_t indexOffset;
+            uint64_t indexSize;
+            uint64_t numRecords;
+        };
+
+        struct Record
+        {
+            uint64_t offset;
+            uint64_t size;
+        };
+
+        static char const * magic()
+        {
+            return "PICNATIV";
+        }
+
+        static uint64_t alignUp( uint64_t const offset )
+        {
+            return ( offset + alignment - 1u ) / alignment * alignment;
+        }
+
+        static void appendBytes(
+            std::vector< char > & dest,
+            void const * src,
+            uint64_t const numBytes
+        )
+        {
+            char const * bytes = static_cast< char const * >( src );
+            dest.insert( dest.end(), bytes, bytes + numBytes );
+        }
+
+        Record const & findRecord( std::string const & name ) const
+        {
+            auto record = m_records.find( name );
+            if( record == m_records.end( ) )
+                throw std::runtime_error( m_fileName + ": record '" + name + "' not found" );
+            return record->second;
+        }
+
+        void writeBytes(
+            void const * data,
+            uint64_t numBytes,
+            uint64_t offset
+        )
+        {
+            char const * bytes = static_cast< char const * >( data );
+            // pwrite is allowed to write less bytes than requested
+            while( numBytes != 0u )
+            {
+                ssize_t const written = ::pwrite( m_fd, bytes, numBytes, off_t( offset ) );
+                if( written < 0 )
+                {
+                    if( errno == EINTR )
+                        continue;
+                    throwError( "write failed" );
+                }
+                bytes += written;
+                offset += uint64_t( written );
+                numBytes -= uint64_t( written );
+            }
+        }
+
+        void readBytes(
+            void * data,
+            uint64_t numBytes,
+            uint64_t offset
+        ) const
+        {
+            if( offset + numBytes > m_fileSize )
+                throw std::runtime_error( m_fileName + ": unexpected end of file" );
+
+            if( m_mapped != nullptr )
+            {
+                std::memcpy( data, m_mapped + offset, numBytes );
+                return;
+            }
+
+            char * bytes = static_cast< char * >( data );
+            while( numBytes != 0u )
+            {
+                ssize_t const numRead = ::pread( m_fd, bytes, numBytes, off_t( offset ) );
+                if( numRead < 0 )
+                {
+                    if( errno == EINTR )
+                        continue;
+                    throwError( "read failed" );
+                }
+                if( numRead == 0 )
+                    throw std::runtime_error( m_fileName + ": unexpected end of file" );
+                bytes += numRead;
+                offset += uint64_t( numRead );
+                numBytes -= uint64_t( numRead );
+            }
+        }
+
+        void throwError( std::string const & what ) const
+        {
+            throw std::runtime_error( m_fileName + ": " + what + " (" + std::strerror( errno ) + ")" );
+        }
+
+        void release()
+        {
+            if( m_mapped != nullptr )
+                ::munmap( m_mapped, m_fileSize );
+            if( m_fd >= 0 )
+                ::close( m_fd );
+            m_mapped = nullptr;
+            m_fd = -1;
+            m_fileSize = 0u;
+            m_offset = 0u;
+            m_isWritable = false;
+            m_records.clear();
+        }
+
+        std::string m_fileName;
+        int m_fd = -1;
+        char * m_mapped = nullptr;
+        uint64_t m_fileSize = 0u;
+        //! offset of the next record
+        uint64_t m_offset = 0u;
+        uint32_t m_step = 0u;
+        bool m_isWritable = false;
+        std::map< std::string, Record > m_records;
+    };
+
+} // namespace native
+} // namespace picongpu
@@ -0,0 +1,403 @@
+/* Copyright 2018 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include "picongpu/plugins/native/NativeWriter.def"
+#include "picongpu/plugins/native/Fields.hpp"
+#include "picongpu/plugins/native/WriteSpecies.hpp"
+#include "picongpu/plugins/native/restart/LoadSpecies.hpp"
+#include "picongpu/plugins/output/IIOBackend.hpp"
+#include "picongpu/plugins/multi/IHelp.hpp"
+#include "picongpu/plugins/multi/Option.hpp"
+#include "picongpu/simulationControl/MovingWindow.hpp"
+#include "picongpu/fields/FieldB.hpp"
+#include "picongpu/fields/FieldE.hpp"
+
+#include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/mappings/simulation/GridController.hpp>
+#include <pmacc/mappings/simulation/SubGrid.hpp>
+#include <pmacc/particles/IdProvider.def>
+#include <pmacc/random/RNGProvider.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+
+namespace picongpu
+{
+
+namespace native
+{
+using namespace pmacc;
+
+namespace detail
+{
+    /** write and load the per cell state of the random number generator
+     *
+     * @tparam T_RNGFactory type of the random number generator provider
+     * @tparam T_hasState false if the generator has no state which must be stored
+     */
+    template<
+        typename T_RNGFactory,
+        bool T_hasState = T_RNGFactory::hasState
+    >
+    struct RNGState
+    {
+        using ValueType = typename T_RNGFactory::DataBoxType::ValueType;
+
+        static void write(ThreadParams* params)
+        {
+            DataConnector &dc = Environment<>::get().DataConnector();
+            auto rngFactory = dc.get< T_RNGFactory >( T_RNGFactory::getName(), true );
+            auto & buffer = rngFactory->getStateBuffer();
+            buffer.deviceToHost();
+            __getTransactionEvent().waitForFinished();
+
+            params->file.write(
+                "rng/state",
+                buffer.getHostBuffer().getBasePointer(),
+                getNumBytes( buffer )
+            );
+            dc.releaseData( T_RNGFactory::getName() );
+        }
+
+        static void load(ThreadParams* params)
+        {
+            DataConnector &dc = Environment<>::get().DataConnector();
+            auto rngFactory = dc.get< T_RNGFactory >( T_RNGFactory::getName(), true );
+            auto & buffer = rngFactory->getStateBuffer();
+
+            params->file.read(
+                "rng/state",
+                buffer.getHostBuffer().getBasePointer(),
+                getNumBytes( buffer )
+            );
+            buffer.hostToDevice();
+            __getTransactionEvent().waitForFinished();
+            dc.releaseData( T_RNGFactory::getName() );
+        }
+
+    private:
+
+        template< typename T_Buffer >
+        static uint64_t getNumBytes( T_Buffer & buffer )
+        {
+            return uint64_t( buffer.getHostBuffer().getDataSpace().productOfComponents() ) *
+                sizeof( ValueType );
+        }
+    };
+
+    //! a stateless generator is fully described by the seed and the time step
+    template< typename T_RNGFactory >
+    struct RNGState<
+        T_RNGFactory,
+        false
+    >
+    {
+        static void write(ThreadParams*)
+        {
+        }
+
+        static void load(ThreadParams*)
+        {
+        }
+    };
+} // namespace detail
+
+/** Writes checkpoints to one raw binary file per MPI rank.
+ *
+ * Each rank stores its field buffers, the attributes of its particles, the
+ * state of the random number generator and of the IdProvider without any
+ * global coordination. A restart requires the same number of MPI ranks and
+ * the same domain decomposition.
+ *
+ * Implements the IIOBackend interface, the backend can only be used to
+ * create checkpoints.
+ */
+class NativeWriter : public IIOBackend
+{
+public:
+    struct Help : public plugins::multi::IHelp
+    {
+        /** creates a instance of ISlave
+         *
+         * @param help plugin defined help
+         * @param id index of the plugin, range: [0;help->getNumPlugins())
+         */
+        std::shared_ptr< ISlave > create(
+            std::shared_ptr< IHelp > & help,
+            size_t const id,
+            MappingDesc* cellDescription
+        )
+        {
+            return std::shared_ptr< ISlave >(
+                new NativeWriter(
+                    help,
+                    id,
+                    cellDescription
+                )
+            );
+        }
+
+        plugins::multi::Option< uint32_t > useMmap = {
+            "mmap",
+            "Map the checkpoint file into memory during a restart instead of reading each record",
+            0u
+        };
+
+        ///! method used by plugin controller to get --help description
+        void registerHelp(
+            boost::program_options::options_description & desc,
+            std::string const & masterPrefix = std::string{ }
+        )
+        {
+            expandHelp(desc, masterPrefix);
+        }
+
+        void expandHelp(
+            boost::program_options::options_description & desc,
+            std::string const & masterPrefix = std::string{ }
+        )
+        {
+            useMmap.registerHelp(
+                desc,
+                masterPrefix + prefix
+            );
+        }
+
+        void validateOptions()
+        {
+        }
+
+        size_t getNumPlugins() const
+        {
+            return 1;
+        }
+
+        std::string getDescription() const
+        {
+            return description;
+        }
+
+        std::string getOptionPrefix() const
+        {
+            return prefix;
+        }
+
+        std::string getName() const
+        {
+            return name;
+        }
+
+        std::string const name = "NativeWriter";
+        //! short description of the plugin
+        std::string const description = "create checkpoints with one binary file per MPI rank";
+        //! prefix used for command line arguments
+        std::string const prefix = "native";
+    };
+
+    //! must be implemented by the user
+    static std::shared_ptr< plugins::multi::IHelp > getHelp()
+    {
+        return std::shared_ptr< plugins::multi::IHelp >( new Help{ } );
+    }
+
+    NativeWriter(
+        std::shared_ptr< plugins::multi::IHelp > & help,
+        size_t const id,
+        MappingDesc* cellDescription
+    ) :
+        m_help( std::static_pointer_cast< Help >(help) ),
+        m_id( id ),
+        m_cellDescription( cellDescription )
+    {
+    }
+
+    virtual ~NativeWriter()
+    {
+    }
+
+    void notify(uint32_t)
+    {
+        /* the backend is always controlled by the class Checkpoint */
+    }
+
+    virtual void restart(
+        uint32_t,
+        std::string const &
+    )
+    {
+        /* ISlave restart interface is not needed becase IIOBackend
+         * restart interface is used
+         */
+    }
+
+    virtual void checkpoint(
+        uint32_t,
+        std::string const &
+    )
+    {
+        /* ISlave checkpoint interface is not needed becase IIOBackend
+         * checkpoint interface is used
+         */
+    }
+
+    void dumpCheckpoint(
+        const uint32_t currentStep,
+        const std::string& checkpointDirectory,
+        const std::string& checkpointFilename
+    )
+    {
+        GridController<simDim> &gc = Environment<simDim>::get().GridController();
+        const SubGrid<simDim>& subGrid = Environment<simDim>::get().SubGrid();
+        const DataSpace<simDim> domainOffset(
+            subGrid.getGlobalDomain().offset +
+            subGrid.getLocalDomain().offset
+        );
+
+        mThreadParams.currentStep = currentStep;
+        mThreadParams.cellDescription = m_cellDescription;
+
+        __getTransactionEvent().waitForFinished();
+
+        const std::string fileName = getFileName(checkpointDirectory, checkpointFilename, currentStep);
+        log<picLog::INPUT_OUTPUT > ("native: (begin) write checkpoint: %1%") % fileName;
+        mThreadParams.file.create(fileName, currentStep);
+
+        /* layout of the domain decomposition, checked during the restart */
+        mThreadParams.file.writeValue< uint64_t >("mpi/size", gc.getGlobalSize());
+        mThreadParams.file.writeValue("domain/localOffset", subGrid.getLocalDomain().offset);
+        mThreadParams.file.writeValue("domain/localSize", subGrid.getLocalDomain().size);
+        mThreadParams.file.writeValue("sim_slides", MovingWindow::getInstance().getSlideCounter(currentStep));
+
+        ForEach<FileCheckpointFields, WriteFields<bmpl::_1> > forEachWriteFields;
+        forEachWriteFields(&mThreadParams);
+
+        ForEach<FileCheckpointParticles, WriteSpecies<bmpl::_1> > forEachWriteSpecies;
+        forEachWriteSpecies(&mThreadParams, domainOffset);
+
+        auto idProviderState = IdProvider<simDim>::getState();
+        log<picLog::INPUT_OUTPUT>("native: Writing IdProvider state (StartId: %1%, NextId: %2%, maxNumProc: %3%)")
+            % idProviderState.startId % idProviderState.nextId % idProviderState.maxNumProc;
+        mThreadParams.file.writeValue("idProvider/state", idProviderState);
+
+        detail::RNGState< RNGFactory >::write(&mThreadParams);
+
+        mThreadParams.file.close();
+        log<picLog::INPUT_OUTPUT > ("native: ( end ) write checkpoint: %1%") % fileName;
+    }
+
+    void doRestart(
+        const uint32_t restartStep,
+        const std::string& restartDirectory,
+        const std::string& restartFilename,
+        const uint32_t restartChunkSize
+    )
+    {
+        GridController<simDim> &gc = Environment<simDim>::get().GridController();
+
+        mThreadParams.currentStep = restartStep;
+        mThreadParams.cellDescription = m_cellDescription;
+
+        const std::string fileName = getFileName(restartDirectory, restartFilename, restartStep);
+        const bool useMmap = m_help->useMmap.get( m_id ) != 0u;
+        log<picLog::INPUT_OUTPUT > ("native: open checkpoint: %1% (mmap: %2%)") % fileName % useMmap;
+        mThreadParams.file.open(fileName, restartStep, useMmap);
+
+        const uint64_t numRanks = mThreadParams.file.readValue< uint64_t >("mpi/size");
+        if (numRanks != gc.getGlobalSize())
+            throw std::runtime_error(
+                fileName + ": checkpoint was created with " + std::to_string(numRanks) +
+                " MPI ranks, a restart requires the same number of ranks"
+            );
+
+        /* load number of slides to initialize MovingWindow */
+        const uint32_t slides = mThreadParams.file.readValue< uint32_t >("sim_slides");
+        log<picLog::INPUT_OUTPUT > ("native: setting slide count for moving window to %1%") % slides;
+        MovingWindow::getInstance().setSlideCounter(slides, restartStep);
+        gc.setStateAfterSlides(slides);
+
+        const pmacc::Selection<simDim>& localDomain = Environment<simDim>::get().SubGrid().getLocalDomain();
+        const DataSpace<simDim> localOffset =
+            mThreadParams.file.readValue< DataSpace<simDim> >("domain/localOffset");
+        const DataSpace<simDim> localSize =
+            mThreadParams.file.readValue< DataSpace<simDim> >("domain/localSize");
+        if (localOffset != localDomain.offset || localSize != localDomain.size)
+            throw std::runtime_error(
+                fileName + ": local domain of the checkpoint " + localOffset.toString() +
+                " + " + localSize.toString() + " differs from the local domain of this rank " +
+                localDomain.offset.toString() + " + " + localDomain.size.toString()
+            );
+
+        ForEach<FileCheckpointFields, LoadFields<bmpl::_1> > forEachLoadFields;
+        forEachLoadFields(&mThreadParams);
+
+        ForEach<FileCheckpointParticles, LoadSpecies<bmpl::_1> > forEachLoadSpecies;
+        forEachLoadSpecies(&mThreadParams, restartChunkSize);
+
+        const auto idProvState =
+            mThreadParams.file.readValue< IdProvider<simDim>::State >("idProvider/state");
+        log<picLog::INPUT_OUTPUT > ("Setting next free id on current rank: %1%") % idProvState.nextId;
+        IdProvider<simDim>::setState(idProvState);
+
+        detail::RNGState< RNGFactory >::load(&mThreadParams);
+
+        mThreadParams.file.close();
+    }
+
+private:
+
+    using RNGFactory = pmacc::random::RNGProvider< simDim, random::Generator >;
+
+    /** path of the checkpoint file of this rank
+     *
+     * @param directory directory of all checkpoints
+     * @param prefix file name prefix, used as path if it is absolute
+     * @param step time step of the checkpoint
+     */
+    static std::string getFileName(
+        std::string const & directory,
+        std::string const & prefix,
+        uint32_t const step
+    )
+    {
+        GridController<simDim> &gc = Environment<simDim>::get().GridController();
+
+        std::string fileName = prefix;
+        if (!boost::filesystem::path(prefix).has_root_path())
+            fileName = directory + std::string("/") + prefix;
+
+        return fileName + "_native_" + std::to_string(step) + "_" +
+            std::to_string(gc.getGlobalRank()) + ".bin";
+    }
+
+    std::shared_ptr< Help > m_help;
+    size_t m_id;
+    MappingDesc* m_cellDescription;
+    ThreadParams mThreadParams;
+};
+
+} //namespace native
+} //namespace picongpu
@@ -0,0 +1,221 @@
+/* Copyright 2018 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+#include "picongpu/plugins/native/NativeWriter.def"
+#include "picongpu/plugins/output/WriteSpeciesCommon.hpp"
+#include "picongpu/plugins/output/ParticleStagingArena.hpp"
+#include "picongpu/plugins/kernel/CopySpecies.kernel"
+#include "picongpu/particles/filter/filter.hpp"
+
+#include <pmacc/compileTime/conversion/MakeSeq.hpp>
+#include <pmacc/compileTime/conversion/RemoveFromSeq.hpp>
+#include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/particles/ParticleDescription.hpp>
+#include <pmacc/particles/particleFilter/FilterFactory.hpp>
+#include <pmacc/particles/particleFilter/PositionFilter.hpp>
+#include <pmacc/traits/GetNumWorkers.hpp>
+#include <pmacc/traits/Resolve.hpp>
+#include <pmacc/mappings/kernel/AreaMapping.hpp>
+
+#include <boost/mpl/vector.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <string>
+
+
+namespace picongpu
+{
+
+namespace native
+{
+using namespace pmacc;
+
+/** frame type of a species in a checkpoint file
+ *
+ * The frame local cell index and the multi mask are replaced by the cell
+ * index relative to the global domain, see hdf5::WriteSpecies.
+ *
+ * @tparam T_Species type of species
+ */
+template< typename T_Species >
+struct CheckpointFrame
+{
+    typedef typename T_Species::FrameType FrameType;
+    typedef typename FrameType::ParticleDescription ParticleDescription;
+    typedef typename FrameType::ValueTypeSeq ParticleAttributeList;
+
+    typedef bmpl::vector2<multiMask, localCellIdx> TypesToDelete;
+    typedef typename RemoveFromSeq<ParticleAttributeList, TypesToDelete>::type ParticleCleanedAttributeList;
+
+    typedef typename MakeSeq<
+        ParticleCleanedAttributeList,
+        totalCellIdx
+    >::type ParticleNewAttributeList;
+
+    typedef
+    typename ReplaceValueTypeSeq<ParticleDescription, ParticleNewAttributeList>::type
+    NewParticleDescription;
+
+    typedef Frame<OperatorCreateVectorBox, NewParticleDescription> type;
+
+    //! name of the record of a particle attribute
+    template< typename T_Attribute >
+    static std::string getRecordName()
+    {
+        return std::string( "particles/" ) + FrameType::getName() + "/" + T_Attribute::getName();
+    }
+
+    //! name of the record with the number of particles
+    static std::string getNumParticlesRecordName()
+    {
+        return std::string( "particles/" ) + FrameType::getName() + "/numParticles";
+    }
+};
+
+/** Write the attribute array of all particles of a species
+ *
+ * @tparam T_Attribute particle attribute identifier
+ */
+template< typename T_Attribute >
+struct WriteParticleAttribute
+{
+    template< typename T_CheckpointFrame, typename T_Frame >
+    HINLINE void operator()(
+        ThreadParams* params,
+        T_CheckpointFrame const,
+        T_Frame & hostFrame,
+        uint64_t const numParticles
+    ) const
+    {
+        using ValueType = typename pmacc::traits::Resolve< T_Attribute >::type::type;
+
+        params->file.write(
+            T_CheckpointFrame::template getRecordName< T_Attribute >(),
+            hostFrame.getIdentifier( T_Attribute() ).getPointer(),
+            numParticles * sizeof( ValueType )
+        );
+    }
+};
+
+/** Copy all particles of a species to host memory and write them to a checkpoint file
+ *
+ * @tparam T_Species type of species
+ */
+template< typename T_Species >
+struct WriteSpecies
+{
+    using CheckpointFrameType = CheckpointFrame< T_Species >;
+    using NativeFrameType = typename CheckpointFrameType::type;
+
+    /**
+     * @param domainOffset offset to the local domain: globalDomain.offset + localDomain.offset
+     */
+    HINLINE void operator()(
+        ThreadParams* params,
+        DataSpace< simDim > const domainOffset
+    )
+    {
+        std::string const speciesName = T_Species::FrameType::getName();
+        log<picLog::INPUT_OUTPUT > ("native: (begin) write species: %1%") % speciesName;
+        DataConnector &dc = Environment<>::get().DataConnector();
+        /* load particle without copy particle data to host */
+        auto speciesTmp = dc.get< T_Species >( speciesName, true );
+
+        particles::filter::IUnary< particles::filter::All > particleFilter{ params->currentStep };
+
+        /* a checkpoint contains all particles, also those outside of the moving window */
+        typedef bmpl::vector< typename GetPositionFilter<simDim>::type > usedFilters;
+        typedef typename FilterFactory<usedFilters>::FilterType MyParticleFilter;
+        MyParticleFilter filter;
+        filter.setStatus(false);
+
+        /* int: assume < 2e9 particles per device */
+        GridBuffer<int, DIM1> counterBuffer(DataSpace<DIM1>(1));
+        AreaMapping < CORE + BORDER, MappingDesc > mapper(*(params->cellDescription));
+
+        constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+            pmacc::math::CT::volume< SuperCellSize >::type::value
+        >::value;
+
+        /* same as hdf5::WriteSpecies: copy into the reused staging arena and
+         * repeat the copy only if the arena is too small
+         */
+        ParticleStagingArena& stagingArena = params->particleStagingArena;
+        NativeFrameType hostFrame;
+        NativeFrameType deviceFrame;
+        uint64_t numParticles = 0;
+
+        while (true)
+        {
+            const size_t capacity = std::min(
+                stagingArena.getNumParticles< NativeFrameType >(),
+                size_t(std::numeric_limits<int>::max())
+            );
+            stagingArena.mapFrames(hostFrame, deviceFrame, capacity);
+
+            counterBuffer.getDeviceBuffer().setValue(0);
+            PMACC_KERNEL( CopySpecies< numWorkers >{} )(
+                mapper.getGridDim(),
+                numWorkers
+            )(
+                counterBuffer.getDeviceBuffer().getPointer(),
+                int(capacity),
+                deviceFrame, speciesTmp->getDeviceParticlesBox(),
+                filter,
+                domainOffset,
+                totalCellIdx_,
+                mapper,
+                particleFilter
+            );
+            counterBuffer.deviceToHost();
+            __getTransactionEvent().waitForFinished();
+
+            numParticles = uint64_t(counterBuffer.getHostBuffer().getDataBox()[0]);
+            if (numParticles <= capacity)
+                break;
+
+            stagingArena.reserve< NativeFrameType >(numParticles + numParticles / 8u);
+        }
+
+        params->file.writeValue(
+            CheckpointFrameType::getNumParticlesRecordName(),
+            numParticles
+        );
+        ForEach<
+            typename NativeFrameType::ValueTypeSeq,
+            WriteParticleAttribute< bmpl::_1 >
+        > writeAttributes;
+        writeAttributes(
+            params,
+            CheckpointFrameType{},
+            forward(hostFrame),
+            numParticles
+        );
+
+        dc.releaseData( speciesName );
+        log<picLog::INPUT_OUTPUT > ("native: ( end ) write species: %1% = %2%") % speciesName % numParticles;
+    }
+};
+
+} //namespace native
+} //namespace picongpu
@@ -0,0 +1,142 @@
+/* Copyright 2018 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+#include "picongpu/plugins/native/NativeWriter.def"
+#include "picongpu/plugins/native/WriteSpecies.hpp"
+#include "picongpu/plugins/output/WriteSpeciesCommon.hpp"
+
+#include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/particles/operations/splitIntoListOfFrames.kernel>
+#include <pmacc/traits/Resolve.hpp>
+
+#include <string>
+
+
+namespace picongpu
+{
+
+namespace native
+{
+using namespace pmacc;
+
+/** Read the attribute array of all particles of a species
+ *
+ * @tparam T_Attribute particle attribute identifier
+ */
+template< typename T_Attribute >
+struct LoadParticleAttribute
+{
+    template< typename T_CheckpointFrame, typename T_Frame >
+    HINLINE void operator()(
+        ThreadParams* params,
+        T_CheckpointFrame const,
+        T_Frame & hostFrame,
+        uint64_t const numParticles
+    ) const
+    {
+        using ValueType = typename pmacc::traits::Resolve< T_Attribute >::type::type;
+
+        params->file.read(
+            T_CheckpointFrame::template getRecordName< T_Attribute >(),
+            hostFrame.getIdentifier( T_Attribute() ).getPointer(),
+            numParticles * sizeof( ValueType )
+        );
+    }
+};
+
+/** Load species from a checkpoint file
+ *
+ * @tparam T_Species type of species
+ */
+template< typename T_Species >
+struct LoadSpecies
+{
+    using CheckpointFrameType = CheckpointFrame< T_Species >;
+    using NativeFrameType = typename CheckpointFrameType::type;
+
+    /** Load species from a checkpoint file
+     *
+     * @param params thread params with the opened checkpoint file
+     * @param restartChunkSize number of particles processed in one kernel call
+     */
+    HINLINE void operator()(ThreadParams* params, const uint32_t restartChunkSize)
+    {
+        std::string const speciesName = T_Species::FrameType::getName();
+        log<picLog::INPUT_OUTPUT > ("native: (begin) load species: %1%") % speciesName;
+        DataConnector &dc = Environment<>::get().DataConnector();
+
+        const pmacc::Selection<simDim>& localDomain = Environment<simDim>::get().SubGrid().getLocalDomain();
+        const pmacc::Selection<simDim>& globalDomain = Environment<simDim>::get().SubGrid().getGlobalDomain();
+
+        // load particle without copying particle data to host
+        auto speciesTmp = dc.get< T_Species >( speciesName, true );
+
+        uint64_t const numParticles = params->file.readValue< uint64_t >(
+            CheckpointFrameType::getNumParticlesRecordName()
+        );
+
+        if (numParticles != 0)
+        {
+            NativeFrameType hostFrame;
+            /*malloc mapped memory*/
+            ForEach<typename NativeFrameType::ValueTypeSeq, MallocMemory<bmpl::_1> > mallocMem;
+            mallocMem(forward(hostFrame), numParticles);
+
+            /*load device pointer of mapped memory*/
+            NativeFrameType deviceFrame;
+            ForEach<typename NativeFrameType::ValueTypeSeq, GetDevicePtr<bmpl::_1> > getDevicePtr;
+            getDevicePtr(forward(deviceFrame), forward(hostFrame));
+
+            ForEach<
+                typename NativeFrameType::ValueTypeSeq,
+                LoadParticleAttribute< bmpl::_1 >
+            > loadAttributes;
+            loadAttributes(
+                params,
+                CheckpointFrameType{},
+                forward(hostFrame),
+                numParticles
+            );
+
+            pmacc::particles::operations::splitIntoListOfFrames(
+                *speciesTmp,
+                deviceFrame,
+                numParticles,
+                restartChunkSize,
+                globalDomain.offset + localDomain.offset,
+                totalCellIdx_,
+                *(params->cellDescription),
+                picLog::INPUT_OUTPUT()
+            );
+
+            /*free host memory*/
+            ForEach<typename NativeFrameType::ValueTypeSeq, FreeMemory<bmpl::_1> > freeMem;
+            freeMem(forward(hostFrame));
+        }
+
+        dc.releaseData( speciesName );
+        log<picLog::INPUT_OUTPUT > ("native: ( end ) load species: %1% = %2%") % speciesName % numParticles;
+    }
+};
+
+} //namespace native
+} //namespace picongpu
@@ -44,7 +44,6 @@ struct GatherSlice
         numRanks(0),
         filteredData(nullptr),
         comm(MPI_COMM_NULL),
-        fullData(nullptr),
         masterRank(0),
         isMPICommInitialized(false)
     {
@@ -126,42 +125,43 @@ struct GatherSlice
                                                        header.sim.size.x() * sizeof (ValueType)
                                                        ));
 
-        MessageHeader* fakeHeader = MessageHeader::create();
-        memcpy(fakeHeader, &header, sizeof (MessageHeader));
-
-        char* recvHeader = new char[ MessageHeader::bytes * numRanks];
-
-        if (fullData == nullptr && mpiRank == masterRank)
-            fullData = (char*) new ValueType[header.sim.size.productOfComponents()];
-
+        /* start with the local slice as the only tile */
+        const size_t elementsCount = header.node.maxSize.productOfComponents() * sizeof (ValueType);
+        tiles.assign(1, Tile{header.node.offset, header.node.maxSize});
+        tileData.resize(elementsCount);
+        memcpy(&tileData[0], data.getPointer(), elementsCount);
+
+        /* binary tree gather
+         *
+         * Ranks are numbered relative to the master. In the level with
+         * distance `stride` all ranks with `relRank % (2 * stride) == stride`
+         * send their collected tiles to `relRank - stride` and leave the loop.
+         * After ceil(log2(numRanks)) levels the master owns all tiles and
+         * receives only log2(numRanks) messages instead of one per rank.
+         */
+        const int relRank = (mpiRank - masterRank + numRanks) % numRanks;
 
         // avoid deadlock between not finished pmacc tasks and mpi blocking collectives
         __getTransactionEvent().waitForFinished();
-        MPI_CHECK(MPI_Gather(fakeHeader, MessageHeader::bytes, MPI_CHAR, recvHeader, MessageHeader::bytes,
-                             MPI_CHAR, masterRank, comm));
-
-        std::vector<int> counts(numRanks);
-        std::vector<int> displs(numRanks);
-        int offset = 0;
-        for (int i = 0; i < numRanks; ++i)
+        for (int stride = 1; stride < numRanks; stride *= 2)
         {
-            MessageHeader* head = (MessageHeader*) (recvHeader + MessageHeader::bytes * i);
-            counts[i] = head->node.maxSize.productOfComponents() * sizeof (ValueType);
-            displs[i] = offset;
-            offset += counts[i];
+            if (relRank % (2 * stride) == stride)
+            {
+                const int dstRank = (relRank - stride + masterRank) % numRanks;
+                MPI_CHECK(MPI_Send(&tiles[0], tiles.size() * sizeof (Tile), MPI_CHAR,
+                                   dstRank, tileTag, comm));
+                MPI_CHECK(MPI_Send(&tileData[0], tileData.size(), MPI_CHAR,
+                                   dstRank, tileDataTag, comm));
+                break;
+            }
+            if (relRank + stride < numRanks)
+            {
+                const int srcRank = (relRank + stride + masterRank) % numRanks;
+                receiveAppend(tiles, srcRank, tileTag);
+                receiveAppend(tileData, srcRank, tileDataTag);
+            }
         }
 
-        const size_t elementsCount = header.node.maxSize.productOfComponents() * sizeof (ValueType);
-
-        // avoid deadlock between not finished pmacc tasks and mpi blocking collectives
-        __getTransactionEvent().waitForFinished();
-        MPI_CHECK(MPI_Gatherv(
-                              (char*) (data.getPointer()), elementsCount, MPI_CHAR,
-                              fullData, &counts[0], &displs[0], MPI_CHAR,
-                              masterRank, comm));
-
-
-
         if (mpiRank == masterRank)
         {
             log<picLog::DOMAINS > ("Master create image");
@@ -176,30 +176,27 @@ struct GatherSlice
                                                        header.sim.size.x() * sizeof (ValueType)
                                                        ));
 
-            for (int i = 0; i < numRanks; ++i)
+            size_t byteOffset = 0;
+            for (size_t i = 0; i < tiles.size(); ++i)
             {
-                MessageHeader* head = (MessageHeader*) (recvHeader + MessageHeader::bytes * i);
+                const Tile& tile = tiles[i];
 
                 log<picLog::DOMAINS > ("part image with offset %1%byte=%2%elements | size %3%  | offset %4%") %
-                    displs[i] % (displs[i] / sizeof (ValueType)) %
-                    head->node.maxSize.toString() %
-                    head->node.offset.toString();
+                    byteOffset % (byteOffset / sizeof (ValueType)) %
+                    tile.size.toString() %
+                    tile.offset.toString();
                 Box srcBox = Box(PitchedBox<ValueType, DIM2 > (
-                                                               (ValueType*) (fullData + displs[i]),
+                                                               (ValueType*) (&tileData[0] + byteOffset),
                                                                DataSpace<DIM2 > (),
-                                                               head->node.maxSize,
-                                                               head->node.maxSize.x() * sizeof (ValueType)
+                                                               tile.size,
+                                                               tile.size.x() * sizeof (ValueType)
                                                                ));
 
-                insertData(dstBox, srcBox, head->node.offset, head->node.maxSize);
+                insertData(dstBox, srcBox, tile.offset, tile.size);
+                byteOffset += tile.size.productOfComponents() * sizeof (ValueType);
             }
-
-            __deleteArray(fullData);
         }
 
-        delete[] recvHeader;
-        MessageHeader::destroy(fakeHeader);
-
         return dstBox;
     }
 
@@ -217,6 +214,33 @@ struct GatherSlice
 
 private:
 
+    /** position and size of a slice in the gathered image */
+    struct Tile
+    {
+        MessageHeader::Size2D offset;
+        MessageHeader::Size2D size;
+    };
+
+    /** receive a message of unknown size and append it to a vector
+     *
+     * @param buffer vector to extend
+     * @param srcRank rank in `comm` of the sender
+     * @param tag message tag
+     */
+    template<typename T>
+    void receiveAppend(std::vector<T>& buffer, int srcRank, int tag)
+    {
+        MPI_Status status;
+        int numBytes = 0;
+        MPI_CHECK(MPI_Probe(srcRank, tag, comm, &status));
+        MPI_CHECK(MPI_Get_count(&status, MPI_CHAR, &numBytes));
+
+        const size_t oldSize = buffer.size();
+        buffer.resize(oldSize + numBytes / sizeof (T));
+        MPI_CHECK(MPI_Recv(&buffer[0] + oldSize, numBytes, MPI_CHAR,
+                           srcRank, tag, comm, MPI_STATUS_IGNORE));
+    }
+
     /*reset this object und set all values to initial state*/
     void reset()
     {
@@ -225,9 +249,8 @@ private:
         if (filteredData != nullptr)
             delete[] filteredData;
         filteredData = nullptr;
-        if (fullData != nullptr)
-            delete[] fullData;
-        fullData = nullptr;
+        tiles.clear();
+        tileData.clear();
         if (isMPICommInitialized)
         {
             // avoid deadlock between not finished pmacc tasks and mpi blocking collectives
@@ -237,8 +260,14 @@ private:
         isMPICommInitialized = false;
     }
 
+    static constexpr int tileTag = 0;
+    static constexpr int tileDataTag = 1;
+
     char* filteredData;
-    char* fullData;
+    /* tiles collected from this rank and its children in the gather tree */
+    std::vector<Tile> tiles;
+    /* concatenated data of all tiles, in the order of `tiles` */
+    std::vector<char> tileData;
     MPI_Comm comm;
     int mpiRank;
     int numRanks;
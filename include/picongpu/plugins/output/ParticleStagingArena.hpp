@@ -0,0 +1,230 @@
+/* Copyright 2018 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include <pmacc/traits/Resolve.hpp>
+
+#include <boost/mpl/size.hpp>
+
+#include <cstddef>
+
+
+namespace picongpu
+{
+
+using namespace pmacc;
+
+namespace particleStaging
+{
+    //! add the size of one attribute value to the number of bytes per particle
+    template< typename T_Attribute >
+    struct AddAttributeSize
+    {
+        HINLINE void operator()( size_t & bytesPerParticle ) const
+        {
+            using type = typename pmacc::traits::Resolve< T_Attribute >::type::type;
+            bytesPerParticle += sizeof( type );
+        }
+    };
+
+    //! point an attribute of a host and device frame into the staging memory
+    template< typename T_Attribute >
+    struct MapStagingMemory
+    {
+        template< typename T_Frame >
+        HINLINE void operator()(
+            T_Frame & hostFrame,
+            T_Frame & deviceFrame,
+            char * hostPtr,
+            char * devicePtr,
+            size_t & offset,
+            size_t const alignment,
+            size_t const numParticles
+        ) const
+        {
+            using type = typename pmacc::traits::Resolve< T_Attribute >::type::type;
+
+            type * hostAttr = nullptr;
+            type * deviceAttr = nullptr;
+            if( hostPtr != nullptr )
+            {
+                hostAttr = reinterpret_cast< type * >( hostPtr + offset );
+                deviceAttr = reinterpret_cast< type * >( devicePtr + offset );
+            }
+            hostFrame.getIdentifier( T_Attribute() ) = VectorDataBox< type >( hostAttr );
+            deviceFrame.getIdentifier( T_Attribute() ) = VectorDataBox< type >( deviceAttr );
+
+            offset += ( numParticles * sizeof( type ) + alignment - 1u ) / alignment * alignment;
+        }
+    };
+} // namespace particleStaging
+
+/** reusable host staging memory for particle output
+ *
+ * One block of host memory (mapped pinned memory if CUDA is used) is shared
+ * by all attributes of a host frame, each attribute array starts aligned.
+ * The block only grows and is kept between dumps to avoid an allocation and
+ * page-locking of the complete species per dump.
+ */
+class ParticleStagingArena
+{
+public:
+
+    //! byte alignment of each attribute array
+    static constexpr size_t alignment = 256u;
+
+    ParticleStagingArena() :
+        m_hostPtr( nullptr ),
+        m_devicePtr( nullptr ),
+        m_numBytes( 0u )
+    {
+    }
+
+    ParticleStagingArena( ParticleStagingArena const & ) = delete;
+    ParticleStagingArena & operator=( ParticleStagingArena const & ) = delete;
+
+    ~ParticleStagingArena()
+    {
+        release();
+    }
+
+    /** number of particles which fit into the arena
+     *
+     * @tparam T_Frame frame type with the attributes to stage
+     */
+    template< typename T_Frame >
+    size_t getNumParticles() const
+    {
+        size_t const padding = getPadding< T_Frame >();
+        if( m_numBytes <= padding )
+            return 0u;
+        return ( m_numBytes - padding ) / getBytesPerParticle< T_Frame >();
+    }
+
+    /** ensure that a number of particles fit into the arena
+     *
+     * The content of the arena is lost if the arena grows.
+     *
+     * @tparam T_Frame frame type with the attributes to stage
+     * @param numParticles number of particles
+     */
+    template< typename T_Frame >
+    void reserve( size_t const numParticles )
+    {
+        size_t const numBytes = numParticles * getBytesPerParticle< T_Frame >() +
+            getPadding< T_Frame >();
+        if( numBytes <= m_numBytes )
+            return;
+
+        release();
+#if( PMACC_CUDA_ENABLED == 1 )
+        CUDA_CHECK( (cuplaError_t)cudaHostAlloc( &m_hostPtr, numBytes, cudaHostAllocMapped ) );
+        CUDA_CHECK( (cuplaError_t)cudaHostGetDevicePointer( &m_devicePtr, m_hostPtr, 0 ) );
+#else
+        m_hostPtr = new char[ numBytes ];
+        m_devicePtr = m_hostPtr;
+#endif
+        m_numBytes = numBytes;
+    }
+
+    /** point all attributes of a host and device frame into the arena
+     *
+     * @param hostFrame frame to access the staged particles on the host
+     * @param deviceFrame frame to fill the arena from the device
+     * @param numParticles number of particles per attribute, must be <= getNumParticles()
+     */
+    template< typename T_Frame >
+    void mapFrames(
+        T_Frame & hostFrame,
+        T_Frame & deviceFrame,
+        size_t const numParticles
+    )
+    {
+        size_t offset = 0u;
+        ForEach<
+            typename T_Frame::ValueTypeSeq,
+            particleStaging::MapStagingMemory< bmpl::_1 >
+        > mapStagingMemory;
+        mapStagingMemory(
+            forward( hostFrame ),
+            forward( deviceFrame ),
+            m_hostPtr,
+            m_devicePtr,
+            forward( offset ),
+            size_t( alignment ),
+            numParticles
+        );
+    }
+
+    //! size of the arena in bytes
+    size_t getNumBytes() const
+    {
+        return m_numBytes;
+    }
+
+private:
+
+    template< typename T_Frame >
+    static size_t getBytesPerParticle()
+    {
+        size_t bytesPerParticle = 0u;
+        ForEach<
+            typename T_Frame::ValueTypeSeq,
+            particleStaging::AddAttributeSize< bmpl::_1 >
+        > addAttributeSize;
+        addAttributeSize( forward( bytesPerParticle ) );
+        return bytesPerParticle;
+    }
+
+    //! upper bound of bytes lost to align all attributes
+    template< typename T_Frame >
+    static size_t getPadding()
+    {
+        return bmpl::size< typename T_Frame::ValueTypeSeq >::type::value * alignment;
+    }
+
+    void release()
+    {
+        if( m_hostPtr != nullptr )
+        {
+#if( PMACC_CUDA_ENABLED == 1 )
+/* see FreeMemory in WriteSpeciesCommon.hpp, cupla does not wrap memory
+ * allocated with cudaHostAlloc
+ */
+#   undef cudaFreeHost
+            CUDA_CHECK( (cuplaError_t)cudaFreeHost( m_hostPtr ) );
+#   define cudaFreeHost(...) cuplaFreeHost(__VA_ARGS__)
+#else
+            __deleteArray( m_hostPtr );
+#endif
+        }
+        m_hostPtr = nullptr;
+        m_devicePtr = nullptr;
+        m_numBytes = 0u;
+    }
+
+    char * m_hostPtr;
+    char * m_devicePtr;
+    size_t m_numBytes;
+};
+
+} // namespace picongpu
@@ -33,6 +33,9 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <thread>
+#include <vector>
 
 #if( PIC_ENABLE_PNG == 1 )
 #   include <pngwriter.h>
@@ -65,15 +68,42 @@ namespace picongpu
          */
         png.setcompressionlevel( 1 );
 
-        //PngWriter coordinate system begin with 1,1
-        for( int y = 0; y < size.y( ); ++y)
+        /* fill the image in tiles of rows in parallel
+         * each thread writes distinct rows of the pngwriter buffer
+         * (up to 8 threads, at least 64 rows per tile)
+         */
+        int const numTiles = std::max(
+            1,
+            std::min(
+                std::min( int( std::thread::hardware_concurrency( ) ), 8 ),
+                size.y( ) / 64
+            )
+        );
+        int const rowsPerTile = ( size.y( ) + numTiles - 1 ) / numTiles;
+
+        auto plotRows = [ & ]( int const beginRow, int const endRow )
         {
-            for( int x = 0; x < size.x( ); ++x )
+            //PngWriter coordinate system begin with 1,1
+            for( int y = beginRow; y < endRow; ++y)
             {
-                float3_X p = data[ y ][ x ];
-                png.plot( x + 1, size.y( ) - y, p.x( ), p.y( ), p.z( ) );
+                for( int x = 0; x < size.x( ); ++x )
+                {
+                    float3_X p = data[ y ][ x ];
+                    png.plot( x + 1, size.y( ) - y, p.x( ), p.y( ), p.z( ) );
+                }
             }
-        }
+        };
+
+        std::vector< std::thread > tileThreads;
+        for( int t = 1; t < numTiles; ++t )
+            tileThreads.emplace_back(
+                plotRows,
+                t * rowsPerTile,
+                std::min( ( t + 1 ) * rowsPerTile, int( size.y( ) ) )
+            );
+        plotRows( 0, std::min( rowsPerTile, int( size.y( ) ) ) );
+        for( auto & thread : tileThreads )
+            thread.join( );
 
         /* scale the image by a user defined relative factor
          * `scale_image` is defined in `png.param`
@@ -25,7 +25,9 @@
 #include "picongpu/plugins/ISimulationPlugin.hpp"
 
 #include <pmacc/traits/HasIdentifier.hpp>
+#include <pmacc/traits/GetNumWorkers.hpp>
 #include <pmacc/cuSTL/cursor/MultiIndexCursor.hpp>
+#include <pmacc/cuSTL/algorithm/kernel/Foreach.hpp>
 
 #include <string>
 #include <iostream>
@@ -118,8 +120,15 @@ namespace particleMerging
                 true
             );
 
+            constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+                pmacc::math::CT::volume< SuperCellSize >::type::value
+            >::value;
+
             /* create `ParticleMergerKernel` instance */
-            ParticleMergerKernel< typename ParticlesType::ParticlesBoxType >
+            ParticleMergerKernel<
+                numWorkers,
+                typename ParticlesType::ParticlesBoxType
+            >
             particleMergerKernel(
                 particles->getDeviceParticlesBox(),
                 this->minParticlesToMerge,
@@ -130,11 +139,14 @@ namespace particleMerging
             );
 
             /* execute particle merging alorithm */
-            algorithm::kernel::Foreach< SuperCellSize > foreach;
+            algorithm::kernel::ForeachLockstep<
+                numWorkers,
+                SuperCellSize
+            > foreach;
             foreach(
                 zone,
-                cursor::make_MultiIndexCursor< simDim >(),
-                particleMergerKernel
+                particleMergerKernel,
+                cursor::make_MultiIndexCursor< simDim >()
             );
 
             /* close all gaps caused by removal of particles */
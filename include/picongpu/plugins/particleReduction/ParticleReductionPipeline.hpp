@@ -0,0 +1,542 @@
+/* Copyright 2013-2018 Axel Huebl, Felix Schmitt, Heiko Burau,
+ *                     Rene Widera, Richard Pausch, Benjamin Worpitz
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+#include "picongpu/plugins/particleReduction/ParticleReduction.kernel"
+#include "picongpu/particles/traits/GenerateSolversIfSpeciesEligible.hpp"
+#include "picongpu/plugins/misc/misc.hpp"
+
+#include <pmacc/pluginSystem/INotify.hpp>
+#include <pmacc/mappings/kernel/AreaMapping.hpp>
+#include <pmacc/mpi/reduceMethods/Reduce.hpp>
+#include <pmacc/mpi/MPIReduce.hpp>
+#include <pmacc/nvidia/functors/Add.hpp>
+#include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/traits/GetNumWorkers.hpp>
+#include <pmacc/traits/HasIdentifiers.hpp>
+#include <pmacc/traits/HasFlag.hpp>
+#include <pmacc/algorithms/ForEach.hpp>
+
+#include <boost/mpl/and.hpp>
+
+#include <mpi.h>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace picongpu
+{
+namespace plugins
+{
+namespace particleReduction
+{
+
+    /** callback receiving the results of a request
+     *
+     * @param localValues values of the local domain
+     * @param reducedValues values reduced over all ranks,
+     *                      only valid if ParticleReductionPipeline::hasResult() is true
+     */
+    using Callback = std::function<
+        void(
+            float_64 const * localValues,
+            float_64 const * reducedValues
+        )
+    >;
+
+    /** all requests for a species and particle filter within a time step
+     *
+     * The requests are served by a single traversal over the particles and
+     * a single reduction over all ranks.
+     */
+    class Traversal
+    {
+    public:
+
+        Traversal(
+            std::string const & key,
+            std::string const & filterName
+        ) :
+            m_key( key ),
+            m_filterName( filterName )
+        {
+        }
+
+        virtual ~Traversal( )
+        {
+        }
+
+        std::string const & getKey( ) const
+        {
+            return m_key;
+        }
+
+        bool hasRequests( ) const
+        {
+            return !m_requests.empty( );
+        }
+
+        //! request the number of macro particles, result has one element
+        void addCount( Callback const & callback )
+        {
+            m_requests.push_back( Request{ ResultIdx::count, callback } );
+        }
+
+        //! request the kinetic and the total energy, result has two elements
+        void addEnergy( Callback const & callback )
+        {
+            m_computeEnergy = true;
+            m_requests.push_back( Request{ ResultIdx::kinEnergy, callback } );
+        }
+
+        /** request an energy histogram, result has numBins + 2 elements
+         *
+         * @param numBins number of bins between minEnergy and maxEnergy
+         * @param minEnergy energy per weighting in PIConGPU units
+         * @param maxEnergy energy per weighting in PIConGPU units
+         */
+        void addHistogram(
+            int const numBins,
+            float_X const minEnergy,
+            float_X const maxEnergy,
+            Callback const & callback
+        )
+        {
+            m_histograms.push_back( HistogramDesc{ numBins, minEnergy, maxEnergy, m_numHistogramBins } );
+            m_requests.push_back( Request{ ResultIdx::numScalars + m_numHistogramBins, callback } );
+            m_numHistogramBins += static_cast< uint32_t >( numBins ) + 2u;
+        }
+
+        /** start the traversal over the particles
+         *
+         * The kernel is executed asynchronously.
+         *
+         * @param currentStep current simulation time step
+         */
+        virtual void launch( uint32_t const currentStep ) = 0;
+
+        /** copy the local results to the host and start the reduction
+         *
+         * @param reduce reduction to use, must be equal for all traversals of a step
+         */
+        void startReduce( pmacc::mpi::MPIReduce & reduce )
+        {
+            copyToHost( m_localValues );
+            m_reducedValues.resize( m_localValues.size( ) );
+            m_mpiRequest = reduce.startReduce(
+                pmacc::nvidia::functors::Add( ),
+                m_reducedValues.data( ),
+                m_localValues.data( ),
+                m_localValues.size( )
+            );
+        }
+
+        //! wait for the reduction, pass the results to all callbacks and remove all requests
+        void finish( )
+        {
+            MPI_CHECK( MPI_Wait( &m_mpiRequest, MPI_STATUS_IGNORE ) );
+
+            for( auto const & request : m_requests )
+                request.callback(
+                    m_localValues.data( ) + request.offset,
+                    m_reducedValues.data( ) + request.offset
+                );
+
+            m_requests.clear( );
+            m_histograms.clear( );
+            m_numHistogramBins = 0u;
+            m_computeEnergy = false;
+        }
+
+    protected:
+
+        /** copy the local results of the last launch to the host
+         *
+         * @param[out] localValues local results, resized to fit all results
+         */
+        virtual void copyToHost( std::vector< float_64 > & localValues ) = 0;
+
+        //! number of result elements
+        uint32_t getNumResults( ) const
+        {
+            return ResultIdx::numScalars + m_numHistogramBins;
+        }
+
+        struct Request
+        {
+            //! index of the first result element
+            uint32_t offset;
+            Callback callback;
+        };
+
+        std::string const m_key;
+        std::string const m_filterName;
+
+        std::vector< Request > m_requests;
+        std::vector< HistogramDesc > m_histograms;
+        //! number of bins of all histograms
+        uint32_t m_numHistogramBins = 0u;
+        bool m_computeEnergy = false;
+
+        std::vector< float_64 > m_localValues;
+        std::vector< float_64 > m_reducedValues;
+        MPI_Request m_mpiRequest = MPI_REQUEST_NULL;
+    };
+
+    /** traversal over the particles of a species
+     *
+     * The device memory is kept between time steps and only reallocated if
+     * the requests of a step need more memory.
+     *
+     * @tparam T_Species particle species type
+     */
+    template< typename T_Species >
+    class SpeciesTraversal : public Traversal
+    {
+    public:
+
+        using FrameType = typename T_Species::FrameType;
+
+        // find all valid filter for the species
+        using EligibleFilters = typename MakeSeqFromNestedSeq<
+            typename bmpl::transform<
+                particles::filter::AllParticleFilters,
+                particles::traits::GenerateSolversIfSpeciesEligible<
+                    bmpl::_1,
+                    T_Species
+                >
+            >::type
+        >::type;
+
+        //! energies are only available if momentum, weighting and a mass are defined
+        static constexpr bool hasEnergy = bmpl::and_<
+            typename pmacc::traits::HasIdentifiers<
+                FrameType,
+                MakeSeq_t<
+                    weighting,
+                    momentum
+                >
+            >::type,
+            typename pmacc::traits::HasFlag<
+                FrameType,
+                massRatio<>
+            >::type
+        >::value;
+
+        SpeciesTraversal(
+            std::string const & key,
+            std::string const & filterName,
+            MappingDesc * cellDescription
+        ) :
+            Traversal(
+                key,
+                filterName
+            ),
+            m_cellDescription( cellDescription )
+        {
+        }
+
+        virtual ~SpeciesTraversal( )
+        {
+            __delete( m_results );
+            __delete( m_histDescs );
+        }
+
+        void launch( uint32_t const currentStep )
+        {
+            uint32_t const numResults = getNumResults( );
+            if( m_results == nullptr || m_results->getGridLayout( ).getDataSpace( ).x( ) < numResults )
+            {
+                __delete( m_results );
+                m_results = new GridBuffer<
+                    float_64,
+                    DIM1
+                >( DataSpace< DIM1 >( numResults ) );
+            }
+
+            // keep at least one description to always have a valid box for the kernel
+            uint32_t const numHistograms = m_histograms.size( );
+            if( m_histDescs == nullptr || m_histDescs->getGridLayout( ).getDataSpace( ).x( ) < numHistograms )
+            {
+                __delete( m_histDescs );
+                m_histDescs = new GridBuffer<
+                    HistogramDesc,
+                    DIM1
+                >( DataSpace< DIM1 >( std::max( numHistograms, 1u ) ) );
+            }
+            if( numHistograms != 0u )
+            {
+                auto descBox = m_histDescs->getHostBuffer( ).getDataBox( );
+                for( uint32_t h = 0u; h < numHistograms; ++h )
+                    descBox[ h ] = m_histograms[ h ];
+                m_histDescs->hostToDevice( );
+            }
+
+            m_results->getDeviceBuffer( ).setValue( 0.0 );
+
+            DataConnector &dc = Environment<>::get( ).DataConnector( );
+            auto particles = dc.get< T_Species >(
+                FrameType::getName( ),
+                true
+            );
+
+            constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+                pmacc::math::CT::volume< SuperCellSize >::type::value
+            >::value;
+
+            AreaMapping<
+                CORE + BORDER,
+                MappingDesc
+            > mapper( *m_cellDescription );
+
+            auto kernel = PMACC_KERNEL( KernelParticleReduction< numWorkers, hasEnergy >{ } )(
+                mapper.getGridDim( ),
+                numWorkers,
+                m_numHistogramBins * sizeof( float_X )
+            );
+
+            auto bindKernel = std::bind(
+                kernel,
+                particles->getDeviceParticlesBox( ),
+                m_results->getDeviceBuffer( ).getDataBox( ),
+                m_histDescs->getDeviceBuffer( ).getDataBox( ),
+                numHistograms,
+                m_numHistogramBins,
+                m_computeEnergy,
+                mapper,
+                std::placeholders::_1
+            );
+
+            ForEach<
+                EligibleFilters,
+                plugins::misc::ExecuteIfNameIsEqual< bmpl::_1 >
+            >{ }(
+                m_filterName,
+                currentStep,
+                bindKernel
+            );
+
+            dc.releaseData( FrameType::getName( ) );
+        }
+
+    protected:
+
+        void copyToHost( std::vector< float_64 > & localValues )
+        {
+            uint32_t const numResults = getNumResults( );
+            m_results->deviceToHost( );
+            localValues.resize( numResults );
+            auto resultBox = m_results->getHostBuffer( ).getDataBox( );
+            for( uint32_t i = 0u; i < numResults; ++i )
+                localValues[ i ] = resultBox[ i ];
+        }
+
+    private:
+
+        MappingDesc * m_cellDescription;
+
+        GridBuffer<
+            float_64,
+            DIM1
+        > * m_results = nullptr;
+
+        GridBuffer<
+            HistogramDesc,
+            DIM1
+        > * m_histDescs = nullptr;
+    };
+
+    /** fused particle diagnostics
+     *
+     * Plugins request particle reductions of a species while they are notified.
+     * After all plugins of a time step are notified, all requests for the same
+     * species and particle filter are computed within one traversal over the
+     * particles. The results of each traversal are reduced with a single
+     * non-blocking reduction; all reductions of a step are in flight at the same
+     * time and the callbacks of the requests are executed after all reductions
+     * are finished, before the plugin notification of the step returns.
+     *
+     * Requests must be added in the same order on all ranks.
+     *
+     * The pipeline is shared by all plugins using it and is destroyed together
+     * with the last plugin.
+     */
+    class ParticleReductionPipeline : public INotify
+    {
+    public:
+
+        /** get the pipeline
+         *
+         * Must be called collectively by all ranks if the pipeline is not
+         * alive.
+         *
+         * @param cellDescription mapping description of the simulation
+         */
+        static std::shared_ptr< ParticleReductionPipeline >
+        getInstance( MappingDesc * cellDescription )
+        {
+            static std::weak_ptr< ParticleReductionPipeline > instance;
+            std::shared_ptr< ParticleReductionPipeline > pipeline = instance.lock( );
+            if( !pipeline )
+            {
+                pipeline = std::shared_ptr< ParticleReductionPipeline >(
+                    new ParticleReductionPipeline( cellDescription )
+                );
+                instance = pipeline;
+            }
+            return pipeline;
+        }
+
+        virtual ~ParticleReductionPipeline( )
+        {
+            Environment<>::get( ).PluginConnector( ).unregisterNotificationCollector( this );
+        }
+
+        //! true if this rank receives the reduced values
+        bool hasResult( )
+        {
+            return m_reduce.hasResult( mpi::reduceMethods::Reduce( ) );
+        }
+
+        /** request the number of macro particles
+         *
+         * @param filterName name of the particle filter
+         * @param callback receives one value
+         */
+        template< typename T_Species >
+        void requestCount(
+            std::string const & filterName,
+            Callback const & callback
+        )
+        {
+            getTraversal< T_Species >( filterName ).addCount( callback );
+        }
+
+        /** request the kinetic and the total energy
+         *
+         * @param filterName name of the particle filter
+         * @param callback receives two values, the kinetic and the total energy
+         *                 in PIConGPU units
+         */
+        template< typename T_Species >
+        void requestEnergy(
+            std::string const & filterName,
+            Callback const & callback
+        )
+        {
+            getTraversal< T_Species >( filterName ).addEnergy( callback );
+        }
+
+        /** request a histogram of the kinetic energy per weighting
+         *
+         * The sum of weightings in a bin is normalized by
+         * particles::TYPICAL_NUM_PARTICLES_PER_MACROPARTICLE.
+         * The bins of all histograms of a species and filter must fit into
+         * the shared memory of a block.
+         *
+         * @param filterName name of the particle filter
+         * @param numBins number of bins between minEnergy and maxEnergy
+         * @param minEnergy energy in PIConGPU units
+         * @param maxEnergy energy in PIConGPU units
+         * @param callback receives numBins + 2 values, the first value is the bin
+         *                 for energies below minEnergy, the last for energies
+         *                 above maxEnergy
+         */
+        template< typename T_Species >
+        void requestEnergyHistogram(
+            std::string const & filterName,
+            int const numBins,
+            float_X const minEnergy,
+            float_X const maxEnergy,
+            Callback const & callback
+        )
+        {
+            getTraversal< T_Species >( filterName ).addHistogram(
+                numBins,
+                minEnergy,
+                maxEnergy,
+                callback
+            );
+        }
+
+        /** execute all requests of the current time step
+         *
+         * Called by the PluginConnector after all plugins of the step are notified.
+         */
+        void notify( uint32_t currentStep )
+        {
+            std::vector< Traversal * > active;
+            for( auto & traversal : m_traversals )
+                if( traversal->hasRequests( ) )
+                    active.push_back( traversal.get( ) );
+
+            // all kernels are started before the first result is copied back
+            for( auto traversal : active )
+                traversal->launch( currentStep );
+            for( auto traversal : active )
+                traversal->startReduce( m_reduce );
+            for( auto traversal : active )
+                traversal->finish( );
+        }
+
+    private:
+
+        ParticleReductionPipeline( MappingDesc * cellDescription ) :
+            m_cellDescription( cellDescription )
+        {
+            // create the communicator of the reduction
+            hasResult( );
+            Environment<>::get( ).PluginConnector( ).registerNotificationCollector( this );
+        }
+
+        template< typename T_Species >
+        Traversal & getTraversal( std::string const & filterName )
+        {
+            std::string const key = T_Species::FrameType::getName( ) + "/" + filterName;
+            for( auto & traversal : m_traversals )
+                if( traversal->getKey( ) == key )
+                    return *traversal;
+
+            m_traversals.emplace_back(
+                new SpeciesTraversal< T_Species >(
+                    key,
+                    filterName,
+                    m_cellDescription
+                )
+            );
+            return *m_traversals.back( );
+        }
+
+        MappingDesc * m_cellDescription;
+
+        //! traversals in the order of their first request
+        std::vector< std::unique_ptr< Traversal > > m_traversals;
+
+        mpi::MPIReduce m_reduce;
+    };
+
+} // namespace particleReduction
+} // namespace plugins
+} // namespace picongpu
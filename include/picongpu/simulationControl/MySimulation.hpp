@@ -31,6 +31,7 @@
 
 #include <pmacc/types.hpp>
 #include <pmacc/simulationControl/SimulationHelper.hpp>
+#include <pmacc/simulationControl/PhaseTimer.hpp>
 #include "picongpu/simulation_defines.hpp"
 #include "picongpu/versionFormat.hpp"
 #include "picongpu/random/seed/ISeed.hpp"
@@ -65,6 +66,7 @@
 #endif
 
 #include "picongpu/particles/synchrotronPhotons/SynchrotronFunctions.hpp"
+#include "picongpu/particles/LookupTableCache.hpp"
 
 #include <pmacc/nvidia/reduce/Reduce.hpp>
 #include <pmacc/memory/boxes/DataBoxDim1Access.hpp>
@@ -143,7 +145,13 @@ public:
             ("periodic", po::value<std::vector<uint32_t> > (&periodic)->multitoken(),
              "specifying whether the grid is periodic (1) or not (0) in each dimension, default: no periodic dimensions")
 
-            ("moving,m", po::value<bool>(&slidingWindow)->zero_tokens(), "enable sliding/moving window");
+            ("moving,m", po::value<bool>(&slidingWindow)->zero_tokens(), "enable sliding/moving window")
+
+            ("particleSort.period", po::value<std::string>(&particleSortPeriod),
+             "period to sort the particles of each supercell by their cell, default: never")
+
+            ("lookupTableCache.directory", po::value<std::string>(&lookupTableCacheDirectory),
+             "directory to keep the synchrotron and bremsstrahlung lookup tables between runs, default: tables are not kept");
     }
 
     std::string pluginGetName() const
@@ -229,6 +237,10 @@ public:
 
         MovingWindow::getInstance().setSlidingWindow(slidingWindow);
 
+        seqParticleSortPeriod = pluginSystem::toTimeSlice( particleSortPeriod );
+
+        particles::LookupTableCache::getInstance().setDirectory( lookupTableCacheDirectory );
+
         log<picLog::DOMAINS > ("rank %1%; localsize %2%; localoffset %3%;") %
             myGPUpos.toString() % gridSizeLocal.toString() % gridOffset.toString();
 
@@ -338,7 +350,10 @@ public:
 
         // init and share random number generator
         pmacc::GridController<simDim>& gridCon = pmacc::Environment<simDim>::get().GridController();
-        rngFactory->init( gridCon.getScalarPosition() ^ seed );
+        /* a stateless generator selects the sequence by the global cell index
+         * and requires the same seed on all ranks
+         */
+        rngFactory->init( RNGFactory::hasState ? gridCon.getScalarPosition() ^ seed : seed );
         dc.share( std::shared_ptr< ISimulationData >( rngFactory ) );
 
         // Initialize synchrotron functions, if there are synchrotron photon species
@@ -358,11 +373,20 @@ public:
 
             this->bremsstrahlungPhotonAngle.init();
         }
+#endif
+
+        /* create field solver
+         * before the particle heap is sized: solvers can allocate additional
+         * device memory, e.g. the swap buffers of YeeFused
+         */
+        this->myFieldSolver = new fields::Solver(*cellDescription);
+
+        // create current interpolation
+        this->myCurrentInterpolation = new typename fields::Solver::CurrentInterpolation;
 
         /* Create an empty allocator. This one is resized after all exchanges
          * for particles are created */
         deviceHeap.reset(new DeviceHeap(0));
-#endif
 
         /* Allocate helper fields for FLYlite population kinetics for atomic physics
          * (histograms, rate matrix, etc.)
@@ -385,21 +409,30 @@ public:
         ForEach< VectorAllSpecies, particles::CreateSpecies<bmpl::_1> > createSpeciesMemory;
         createSpeciesMemory( deviceHeap, cellDescription );
 
+        /* adaptive exchange stacks grow outside of the particle heap,
+         * keep their maximum growth free in addition to the reserved memory
+         */
+        size_t maxExchangeGrowth( 0 );
+        ForEach< VectorAllSpecies, particles::AddMaxExchangeGrowth<bmpl::_1> > addMaxExchangeGrowth;
+        addMaxExchangeGrowth( forward( maxExchangeGrowth ) );
+        size_t const requiredReservedMemory = reservedGpuMemorySize + maxExchangeGrowth;
+        log<picLog::MEMORY > ("reserved memory %1% MiB + maximum exchange growth %2% MiB") %
+            (reservedGpuMemorySize / 1024 / 1024) % (maxExchangeGrowth / 1024 / 1024);
+
         size_t freeGpuMem(0);
         Environment<>::get().MemoryInfo().getMemoryInfo(&freeGpuMem);
-        if(freeGpuMem < reservedGpuMemorySize)
+        if(freeGpuMem < requiredReservedMemory)
         {
             pmacc::log< picLog::MEMORY > ("%1% MiB free memory < %2% MiB required reserved memory")
-                % (freeGpuMem / 1024 / 1024) % (reservedGpuMemorySize / 1024 / 1024) ;
+                % (freeGpuMem / 1024 / 1024) % (requiredReservedMemory / 1024 / 1024) ;
             std::stringstream msg;
             msg << "Cannot reserve "
-                << (reservedGpuMemorySize / 1024 / 1024) << " MiB as there is only "
+                << (requiredReservedMemory / 1024 / 1024) << " MiB as there is only "
                 << (freeGpuMem / 1024 / 1024) << " MiB free device memory left";
             throw std::runtime_error(msg.str());
         }
 
-#if( PMACC_CUDA_ENABLED == 1 )
-        size_t heapSize = freeGpuMem - reservedGpuMemorySize;
+        size_t heapSize = freeGpuMem - requiredReservedMemory;
 
         if( Environment<>::get().MemoryInfo().isSharedMemoryPool() )
         {
@@ -411,6 +444,7 @@ public:
 
         // initializing the heap for particles
         deviceHeap->destructiveResize(heapSize);
+#if( PMACC_CUDA_ENABLED == 1 )
         MallocMCBuffer<DeviceHeap>* mallocMCBuffer = new MallocMCBuffer<DeviceHeap>(deviceHeap);
         dc.share( std::shared_ptr< ISimulationData >( mallocMCBuffer ) );
 #endif
@@ -421,12 +455,6 @@ public:
         log<picLog::MEMORY > ("free mem after all mem is allocated %1% MiB") % (freeGpuMem / 1024 / 1024);
 
         IdProvider<simDim>::init();
-
-        // create field solver
-        this->myFieldSolver = new fields::Solver(*cellDescription);
-
-        // create current interpolation
-        this->myCurrentInterpolation = new typename fields::Solver::CurrentInterpolation;
 #if( PMACC_CUDA_ENABLED == 1 )
         /* add CUDA streams to the StreamController for concurrent execution */
         Environment<>::get().StreamController().addStreams(6);
@@ -549,7 +577,10 @@ public:
             ionizers<>
         >::type;
         ForEach< VectorSpeciesWithIonizers, particles::CallIonization< bmpl::_1 > > particleIonization;
-        particleIonization( cellDescription, currentStep );
+        {
+            PhaseTimer::Scope phase( "ionization" );
+            particleIonization( cellDescription, currentStep );
+        }
 
         /* FLYlite population kinetics for atomic physics */
         using AllFlyLiteIons = typename pmacc::particles::traits::FilterByFlag<
@@ -562,7 +593,10 @@ public:
             particles::CallPopulationKinetics< bmpl::_1 >,
             bmpl::_1
         > populationKinetics;
-        populationKinetics( currentStep );
+        {
+            PhaseTimer::Scope phase( "populationKinetics" );
+            populationKinetics( currentStep );
+        }
 
         /* call the synchrotron radiation module for each radiating species (normally electrons) */
         typedef typename pmacc::particles::traits::FilterByFlag<VectorAllSpecies,
@@ -572,7 +606,10 @@ public:
             AllSynchrotronPhotonsSpecies,
             particles::CallSynchrotronPhotons< bmpl::_1 >
         > synchrotronRadiation;
-        synchrotronRadiation( cellDescription, currentStep, this->synchrotronFunctions );
+        {
+            PhaseTimer::Scope phase( "synchrotron" );
+            synchrotronRadiation( cellDescription, currentStep, this->synchrotronFunctions );
+        }
 
 #if( PMACC_CUDA_ENABLED == 1 )
         /* Bremsstrahlung */
@@ -585,12 +622,41 @@ public:
             VectorSpeciesWithBremsstrahlung,
             particles::CallBremsstrahlung< bmpl::_1 >
         > particleBremsstrahlung;
-        particleBremsstrahlung(
-            cellDescription,
-            currentStep,
-            this->scaledBremsstrahlungSpectrumMap,
-            this->bremsstrahlungPhotonAngle);
+        {
+            PhaseTimer::Scope phase( "bremsstrahlung" );
+            particleBremsstrahlung(
+                cellDescription,
+                currentStep,
+                this->scaledBremsstrahlungSpectrumMap,
+                this->bremsstrahlungPhotonAngle);
+        }
 #endif
+        /* species with a fused current deposition (see pusher.param) scatter
+         * their current during the push, therefore the current is reset before
+         */
+        auto fieldJ = dc.get< FieldJ >( FieldJ::getName(), true );
+        {
+            PhaseTimer::Scope phase( "currentDeposition" );
+            FieldJ::ValueType zeroJ( FieldJ::ValueType::create(0.) );
+            fieldJ->assign( zeroJ );
+        }
+
+        /* particles ordered by cell access neighboring field and current
+         * values from neighboring workers during the push and the current deposition
+         */
+        if(
+            !particleSortPeriod.empty() &&
+            pluginSystem::containsStep(
+                seqParticleSortPeriod,
+                currentStep
+            )
+        )
+        {
+            PhaseTimer::Scope phase( "particleSort" );
+            ForEach< VectorAllSpecies, particles::SortSpecies< bmpl::_1 > > sortSpecies;
+            sortSpecies();
+        }
+
         EventTask initEvent = __getTransactionEvent();
         EventTask updateEvent;
         EventTask commEvent;
@@ -610,33 +676,40 @@ public:
         dc.releaseData( FieldE::getName() );
         dc.releaseData( FieldB::getName() );
 
-        this->myFieldSolver->update_beforeCurrent(currentStep);
-
-        auto fieldJ = dc.get< FieldJ >( FieldJ::getName(), true );
-        FieldJ::ValueType zeroJ( FieldJ::ValueType::create(0.) );
-        fieldJ->assign( zeroJ );
-
-        __setTransactionEvent(commEvent);
-        (*currentBGField)(fieldJ, nvfct::Add(), FieldBackgroundJ(fieldJ->getUnit()),
-                          currentStep, FieldBackgroundJ::activated);
+        {
+            PhaseTimer::Scope phase( "fieldSolver" );
+            this->myFieldSolver->update_beforeCurrent(currentStep);
+        }
 
         typedef typename pmacc::particles::traits::FilterByFlag
         <
             VectorAllSpecies,
             current<>
         >::type VectorSpeciesWithCurrentSolver;
-        ForEach<
-            VectorSpeciesWithCurrentSolver,
-            ComputeCurrent<
-                bmpl::_1,
-                bmpl::int_<CORE + BORDER>
-            >
-        > computeCurrent;
-        computeCurrent( currentStep );
+        {
+            PhaseTimer::Scope phase( "currentDeposition" );
+            __setTransactionEvent(commEvent);
+            (*currentBGField)(fieldJ, nvfct::Add(), FieldBackgroundJ(fieldJ->getUnit()),
+                              currentStep, FieldBackgroundJ::activated);
+
+            ForEach<
+                VectorSpeciesWithCurrentSolver,
+                ComputeCurrent<
+                    bmpl::_1,
+                    bmpl::int_<CORE + BORDER>
+                >
+            > computeCurrent;
+            computeCurrent( currentStep );
+        }
 
         if(bmpl::size<VectorSpeciesWithCurrentSolver>::type::value > 0)
         {
-            EventTask eRecvCurrent = fieldJ->asyncCommunication(__getTransactionEvent());
+            EventTask eRecvCurrent;
+            {
+                PhaseTimer::Scope phase( "currentCommunication" );
+                eRecvCurrent = fieldJ->asyncCommunication(__getTransactionEvent());
+            }
+            PhaseTimer::Scope phase( "currentInterpolation" );
 
             const DataSpace<simDim> currentRecvLower( GetMargin<typename fields::Solver::CurrentInterpolation>::LowerMargin( ).toRT( ) );
             const DataSpace<simDim> currentRecvUpper( GetMargin<typename fields::Solver::CurrentInterpolation>::UpperMargin( ).toRT( ) );
@@ -665,6 +738,7 @@ public:
 
         dc.releaseData( FieldJ::getName() );
 
+        PhaseTimer::Scope phase( "fieldSolver" );
         this->myFieldSolver->update_afterCurrent(currentStep);
     }
 
@@ -730,7 +804,15 @@ public:
     {
         GridController<simDim>& gc = Environment<simDim>::get().GridController();
 
-        if (gc.slide())
+        bool const isNewDomain = gc.slide();
+
+        /* the neighbors in y direction changed, all ranks agree on the
+         * adapted exchange sizes to keep them equal to their new neighbors
+         */
+        ForEach< VectorAllSpecies, particles::CallAgreeExchangeSizes< bmpl::_1 > > agreeExchangeSizes;
+        agreeExchangeSizes( );
+
+        if (isNewDomain)
         {
             log<picLog::SIMULATION_STATE > ("slide in step %1%") % currentStep;
             resetAll(currentStep);
@@ -811,6 +893,11 @@ protected:
 
     bool slidingWindow;
     bool showVersionOnce;
+
+    std::string particleSortPeriod;
+    SeqOfTimeSlices seqParticleSortPeriod;
+
+    std::string lookupTableCacheDirectory;
 };
 } /* namespace picongpu */
 
@@ -41,6 +41,10 @@
 
 #include <mpi.h>
 
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
 namespace pmacc
 {
 
@@ -63,7 +67,8 @@ namespace detail
         EnvironmentContext( ) :
             m_isMpiInitialized( false ),
             m_isDeviceSelected( false ),
-            m_isSubGridDefined( false )
+            m_isSubGridDefined( false ),
+            m_requiredMpiThreadLevel( MPI_THREAD_SINGLE )
         {
         }
 
@@ -76,6 +81,9 @@ namespace detail
         /** state if the SubGrid is defined */
         bool m_isSubGridDefined;
 
+        /** MPI thread support level requested during init() */
+        int m_requiredMpiThreadLevel;
+
         /** get the singleton EnvironmentContext
          *
          * @return instance of EnvironmentContext
@@ -113,6 +121,21 @@ namespace detail
             return m_isSubGridDefined;
         }
 
+        /** request a minimal MPI thread support level
+         *
+         * Must be called before init(), the highest requested level is used.
+         *
+         * @param level MPI thread support level, e.g. MPI_THREAD_MULTIPLE
+         */
+        void requireMpiThreadLevel( int level )
+        {
+            PMACC_ASSERT_MSG(
+                !m_isMpiInitialized,
+                "MPI thread support must be requested before MPI is initialized!"
+            );
+            m_requiredMpiThreadLevel = std::max( m_requiredMpiThreadLevel, level );
+        }
+
         /** initialize the environment
          *
          * After this call it is allowed to use MPI.
@@ -148,6 +171,18 @@ namespace detail
             EnvironmentContext::getInstance().finalize();
         }
 
+        /** request a minimal MPI thread support level
+         *
+         * Must be called before Environment< DIM >::initDevices(), e.g. while
+         * parsing command line options.
+         *
+         * @param level MPI thread support level, e.g. MPI_THREAD_MULTIPLE
+         */
+        void requireMpiThreadLevel( int level )
+        {
+            EnvironmentContext::getInstance().requireMpiThreadLevel( level );
+        }
+
         /** get the singleton StreamController
          *
          * @return instance of StreamController
@@ -420,7 +455,24 @@ namespace detail
         m_isMpiInitialized = true;
 
         // MPI_Init with NULL is allowed since MPI 2.0
-        MPI_CHECK(MPI_Init(NULL,NULL));
+        if( m_requiredMpiThreadLevel == MPI_THREAD_SINGLE )
+        {
+            MPI_CHECK(MPI_Init(NULL,NULL));
+            return;
+        }
+
+        /* thread support is only requested if a plugin needs it,
+         * e.g. for a background I/O thread
+         */
+        int providedThreadLevel = MPI_THREAD_SINGLE;
+        MPI_CHECK(MPI_Init_thread(NULL, NULL, m_requiredMpiThreadLevel, &providedThreadLevel));
+        if( providedThreadLevel < m_requiredMpiThreadLevel )
+            throw std::runtime_error(
+                std::string( "MPI provides thread support level " ) +
+                std::to_string( providedThreadLevel ) +
+                " but level " + std::to_string( m_requiredMpiThreadLevel ) +
+                " is required"
+            );
     }
 
     void EnvironmentContext::finalize()
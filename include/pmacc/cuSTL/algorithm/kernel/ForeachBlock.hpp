@@ -89,10 +89,10 @@ BOOST_PP_REPEAT_FROM_TO(1, BOOST_PP_INC(FOREACH_KERNEL_MAX_PARAMS), KERNEL_FOREA
         /* ... */                                                                                           \
         BOOST_PP_REPEAT(N, SHIFT_CURSOR_ZONE, _)                                                            \
                                                                                                             \
-        auto blockDim = ThreadBlock::toRT();                                                                \
+        auto threadBlock = ThreadBlock::toRT();                                                              \
         detail::SphericMapper<Zone::dim, BlockDim> mapper;                                                  \
         using namespace pmacc;                                                                              \
-        PMACC_KERNEL(detail::KernelForeachBlock{})(mapper.cudaGridDim(p_zone.size), blockDim)               \
+        PMACC_KERNEL(detail::KernelForeachBlock{})(mapper.cudaGridDim(p_zone.size), threadBlock)             \
                     /* c0_shifted, c1_shifted, ... */                                                       \
             (mapper, BOOST_PP_ENUM(N, SHIFTED_CURSOR, _), functor);                   \
     }
@@ -104,7 +104,8 @@ BOOST_PP_REPEAT_FROM_TO(1, BOOST_PP_INC(FOREACH_KERNEL_MAX_PARAMS), KERNEL_FOREA
  * So if BlockDim is 4x4x4 it shifts 64 cursors to (0,0,0), 64 to (4,0,0), 64 to (8,0,0), ...
  *
  * \tparam BlockDim 3D compile-time vector (pmacc::math::CT::Int) of the size of the cuda blockDim.
- * \tparam ThreadBlock ignored
+ * \tparam ThreadBlock 3D compile-time vector (pmacc::math::CT::Int) of the number of threads
+ *                     used to launch the kernel
  */
 template<typename BlockDim, typename ThreadBlock = BlockDim>
 struct ForeachBlock
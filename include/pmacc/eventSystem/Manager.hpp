@@ -25,8 +25,11 @@
 #include "pmacc/eventSystem/tasks/ITask.hpp"
 #include "pmacc/Environment.def"
 
-#include <map>
+#include <list>
+#include <unordered_map>
 #include <set>
+#include <utility>
+#include <cstdint>
 
 namespace pmacc
 {
@@ -39,9 +42,20 @@ namespace pmacc
     class Manager : public IEvent
     {
     public:
-        typedef std::map<id_t, ITask*> TaskMap;
+        typedef std::unordered_map<id_t, ITask*> TaskMap;
         typedef std::set<id_t> TaskSet;
 
+        /** counters describing the work of the scheduler */
+        struct Statistics
+        {
+            //! number of calls to ITask::execute()
+            uint64_t numPolled = 0u;
+            //! number of active tasks which finished
+            uint64_t numFinished = 0u;
+            //! number of calls to `execute()` where no active task finished
+            uint64_t numIdleCalls = 0u;
+        };
+
         bool execute(id_t taskToWait = 0);
 
         void event(id_t eventId, EventType type, IEventData* data);
@@ -63,6 +77,15 @@ namespace pmacc
          */
         void waitForAllTasks();
 
+        /**
+         * blocks until all tasks of a type are finished
+         *
+         * Tasks of other types are executed too but are not waited for.
+         *
+         * @param taskType type of the tasks to wait for, e.g. `ITask::TASK_MPI`
+         */
+        void waitForAllTasks(ITask::TaskType taskType);
+
         /**
          * adds an ITask to the manager and returns an EventTask for it
          * @param task task to add to the manager
@@ -74,8 +97,27 @@ namespace pmacc
 
         std::size_t getCount();
 
+        /** get the scheduler counters accumulated since the last reset */
+        Statistics const & getStatistics() const
+        {
+            return statistics;
+        }
+
+        void resetStatistics()
+        {
+            statistics = Statistics();
+        }
+
     private:
 
+        /** active tasks in the order of insertion
+         *
+         * A list keeps iterators of all other elements valid if a task is
+         * removed, even if `execute()` is called recursively by a task.
+         */
+        typedef std::list<std::pair<id_t, ITask*> > TaskQueue;
+        typedef std::unordered_map<id_t, TaskQueue::iterator> TaskIndex;
+
         friend struct detail::Environment;
 
         inline ITask* getPassiveITaskIfNotFinished(id_t taskId) const;
@@ -94,8 +136,18 @@ namespace pmacc
             return instance;
         }
 
-        TaskMap tasks;
+        //! true if an active or passive task of the given type is not finished
+        inline bool hasTaskOfType(ITask::TaskType taskType);
+
+        //! remove a finished active task from the queue and the index
+        inline void removeActiveTask(TaskIndex::iterator taskIter);
+
+        TaskQueue activeQueue;
+        TaskIndex tasks;
+        //! next active task executed by `execute()`
+        TaskQueue::iterator nextTask;
         TaskMap passiveTasks;
+        Statistics statistics;
     };
 
 } //namespace pmacc
@@ -58,28 +58,32 @@ inline bool Manager::execute( id_t taskToWait )
     }
 #endif
 
-    static TaskMap::iterator iter = tasks.begin( );
+    if ( nextTask == activeQueue.end( ) )
+        nextTask = activeQueue.begin( );
 
-    if ( iter == tasks.end( ) )
-        iter = tasks.begin( );
-
-    // this is the slow but very save variant to delete tasks in a map
-    while ( iter != tasks.end( ) )
+    bool isAnyTaskFinished = false;
+    /* the queue is a list, therefore `nextTask` stays valid if tasks are
+     * removed by a recursive call of this method
+     */
+    while ( nextTask != activeQueue.end( ) )
     {
-        id_t id = iter->first;
-        ITask* taskPtr = iter->second;
+        id_t id = nextTask->first;
+        ITask* taskPtr = nextTask->second;
         PMACC_ASSERT( taskPtr != nullptr );
-        ++iter;
+        ++nextTask;
+        ++statistics.numPolled;
 #ifdef DEBUG_EVENTS
         if ( counter == 500000 )
             std::cout << taskPtr->toString( ) << " " << passiveTasks.size( ) << std::endl;
 #endif
         if ( taskPtr->execute( ) )
         {
+            isAnyTaskFinished = true;
             /*test if task is deleted by other stackdeep*/
-            if ( getActiveITaskIfNotFinished( id ) == taskPtr )
+            TaskIndex::iterator taskIter = tasks.find( id );
+            if ( taskIter != tasks.end( ) && taskIter->second->second == taskPtr )
             {
-                tasks.erase( id );
+                removeActiveTask( taskIter );
                 __delete(taskPtr);
             }
 #ifdef DEBUG_EVENTS
@@ -88,7 +92,7 @@ inline bool Manager::execute( id_t taskToWait )
 
             if ( taskToWait == id )
             {
-                iter = tasks.end( );
+                nextTask = activeQueue.end( );
 #ifdef DEBUG_EVENTS
                 --deep;
 #endif
@@ -97,6 +101,9 @@ inline bool Manager::execute( id_t taskToWait )
         }
     }
 
+    if ( !isAnyTaskFinished )
+        ++statistics.numIdleCalls;
+
 #ifdef DEBUG_EVENTS
     --deep;
 #endif
@@ -130,12 +137,22 @@ inline ITask* Manager::getPassiveITaskIfNotFinished( id_t taskId ) const
 
 inline ITask* Manager::getActiveITaskIfNotFinished( id_t taskId ) const
 {
-    TaskMap::const_iterator it = tasks.find( taskId );
+    TaskIndex::const_iterator it = tasks.find( taskId );
     if ( it != tasks.end( ) )
-        return it->second;
+        return it->second->second;
     return nullptr;
 }
 
+inline void Manager::removeActiveTask( TaskIndex::iterator taskIter )
+{
+    TaskQueue::iterator queueIter = taskIter->second;
+    if ( nextTask == queueIter )
+        ++nextTask;
+    activeQueue.erase( queueIter );
+    tasks.erase( taskIter );
+    ++statistics.numFinished;
+}
+
 inline void Manager::waitForFinished( id_t taskId )
 {
     if( taskId == 0 )
@@ -175,10 +192,36 @@ inline void Manager::waitForAllTasks( )
     PMACC_ASSERT( tasks.size( ) == 0 );
 }
 
+inline void Manager::waitForAllTasks( ITask::TaskType const taskType )
+{
+    while ( hasTaskOfType( taskType ) )
+    {
+        this->execute( );
+    }
+}
+
+inline bool Manager::hasTaskOfType( ITask::TaskType const taskType )
+{
+    for ( auto & task : activeQueue )
+        if ( task.second->getTaskType( ) == taskType )
+            return true;
+    for ( auto & task : passiveTasks )
+        if ( task.second->getTaskType( ) == taskType )
+            return true;
+    return false;
+}
+
 inline void Manager::addTask( ITask *task )
 {
     PMACC_ASSERT( task != nullptr );
-    tasks[task->getId( )] = task;
+    TaskIndex::iterator taskIter = tasks.find( task->getId( ) );
+    if ( taskIter != tasks.end( ) )
+        taskIter->second->second = task;
+    else
+        tasks[task->getId( )] = activeQueue.insert(
+            activeQueue.end( ),
+            std::make_pair( task->getId( ), task )
+        );
 }
 
 inline void Manager::addPassiveTask( ITask *task )
@@ -189,18 +232,18 @@ inline void Manager::addPassiveTask( ITask *task )
     passiveTasks[task->getId( )] = task;
 }
 
-inline Manager::Manager( )
+inline Manager::Manager( ) : nextTask( activeQueue.end( ) )
 {
 }
 
-inline Manager::Manager( const Manager& )
+inline Manager::Manager( const Manager& ) : nextTask( activeQueue.end( ) )
 {
 }
 
 
 inline std::size_t Manager::getCount( )
 {
-    for ( TaskMap::iterator iter = tasks.begin( ); iter != tasks.end( ); ++iter )
+    for ( TaskQueue::iterator iter = activeQueue.begin( ); iter != activeQueue.end( ); ++iter )
     {
         if ( iter->second != nullptr )
         {
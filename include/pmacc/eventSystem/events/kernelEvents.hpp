@@ -26,6 +26,7 @@
 #include "pmacc/dimensions/DataSpace.hpp"
 #include "pmacc/traits/GetNComponents.hpp"
 #include "pmacc/eventSystem/EventSystem.hpp"
+#include "pmacc/eventSystem/tasks/KernelProfiler.hpp"
 #include "pmacc/Environment.hpp"
 #include "pmacc/nvidia/gpuEntryFunction.hpp"
 
@@ -191,7 +192,7 @@ namespace exec
             );
 
             pmacc::TaskKernel* taskKernel = pmacc::Environment<>::get().Factory().createTaskKernel(
-                typeid( kernelName ).name()
+                kernelName
             );
 
             DataSpace<
@@ -206,6 +207,27 @@ namespace exec
                 >::value
             > blockExtent( m_blockExtent );
 
+            KernelProfiler & profiler = KernelProfiler::getInstance( );
+            bool const isProfiled = profiler.isEnabled( );
+            KernelProfiler::Launch launch;
+            if( isProfiled )
+            {
+                DataSpace< DIM3 > gridExtent3D = DataSpace< DIM3 >::create( 1 );
+                DataSpace< DIM3 > blockExtent3D = DataSpace< DIM3 >::create( 1 );
+                for( uint32_t d = 0u; d < gridExtent.getDim( ); ++d )
+                    gridExtent3D[ d ] = gridExtent[ d ];
+                for( uint32_t d = 0u; d < blockExtent.getDim( ); ++d )
+                    blockExtent3D[ d ] = blockExtent[ d ];
+                launch = profiler.begin(
+                    typeid( m_kernel.m_kernelFunctor ).name( ),
+                    m_kernel.m_file + std::string( ":" ) + std::to_string( m_kernel.m_line ),
+                    gridExtent3D,
+                    blockExtent3D,
+                    m_sharedMemByte,
+                    taskKernel->getCudaStream( )
+                );
+            }
+
             CUPLA_KERNEL( typename T_Kernel::KernelType )(
                 gridExtent,
                 blockExtent,
@@ -218,6 +240,11 @@ namespace exec
                 cudaGetLastError( ),
                 std::string( "Last error after kernel launch " ) + kernelInfo
             );
+            if( isProfiled )
+            {
+                profiler.end( launch, taskKernel->getCudaStream( ) );
+                taskKernel->setProfilerLaunch( launch );
+            }
             CUDA_CHECK_KERNEL_MSG(
                 cudaDeviceSynchronize( ),
                 std::string( "Crash after kernel launch " ) + kernelInfo
@@ -0,0 +1,355 @@
+/* Copyright 2018 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+#include "pmacc/dimensions/DataSpace.hpp"
+
+#if defined(__GNUC__)
+#   include <cxxabi.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace pmacc
+{
+
+    /** opt-in profiler for all kernels started with PMACC_KERNEL
+     *
+     * Each kernel launch is enclosed by two timing events in the stream of
+     * its TaskKernel. The elapsed time is read when the task is finished,
+     * therefore the profiler does not add a synchronization on devices with
+     * asynchronous streams. Devices emulated by cupla (CPU backends)
+     * synchronize the stream to take the time of an event.
+     *
+     * The profiler collects call count, launch geometry and duration per
+     * kernel and call site and writes a summary and a Chrome trace
+     * (chrome://tracing) per rank.
+     */
+    class KernelProfiler
+    {
+    public:
+
+        //! events and configuration of a single kernel launch
+        struct Launch
+        {
+            //! index of the kernel in the statistics
+            size_t kernelId;
+            DataSpace< DIM3 > gridExtent;
+            DataSpace< DIM3 > blockExtent;
+            size_t sharedMemByte;
+            //! host time of the launch in microseconds since the profiler was enabled
+            double launchTime;
+            cudaEvent_t start;
+            cudaEvent_t stop;
+        };
+
+        static KernelProfiler & getInstance()
+        {
+            static KernelProfiler instance;
+            return instance;
+        }
+
+        /** enable the profiler
+         *
+         * @param maxTraceEvents maximum number of launches stored for the trace,
+         *                       the statistics contain all launches
+         */
+        void enable( size_t const maxTraceEvents )
+        {
+            m_isEnabled = true;
+            m_maxTraceEvents = maxTraceEvents;
+            m_startTime = Clock::now();
+        }
+
+        bool isEnabled() const
+        {
+            return m_isEnabled;
+        }
+
+        /** record the start of a kernel
+         *
+         * @param mangledName type name of the kernel functor (typeid)
+         * @param location file and line of the kernel call
+         * @param gridExtent number of blocks
+         * @param blockExtent number of workers per block
+         * @param sharedMemByte dynamic shared memory per block
+         * @param stream stream of the kernel
+         */
+        Launch begin(
+            char const * mangledName,
+            std::string const & location,
+            DataSpace< DIM3 > const & gridExtent,
+            DataSpace< DIM3 > const & blockExtent,
+            size_t const sharedMemByte,
+            cudaStream_t stream
+        )
+        {
+            Launch launch;
+            launch.kernelId = getKernelId( mangledName, location );
+            launch.gridExtent = gridExtent;
+            launch.blockExtent = blockExtent;
+            launch.sharedMemByte = sharedMemByte;
+            std::chrono::duration< double, std::micro > const launchTime = Clock::now() - m_startTime;
+            launch.launchTime = launchTime.count();
+            launch.start = createEvent();
+            launch.stop = createEvent();
+            CUDA_CHECK( cudaEventRecord( launch.start, stream ) );
+            return launch;
+        }
+
+        /** record the end of a kernel
+         *
+         * @param launch launch returned by begin()
+         * @param stream stream of the kernel
+         */
+        void end(
+            Launch const & launch,
+            cudaStream_t stream
+        )
+        {
+            CUDA_CHECK( cudaEventRecord( launch.stop, stream ) );
+        }
+
+        /** account the duration of a finished kernel
+         *
+         * @param launch launch returned by begin(), all work of the kernel must be finished
+         */
+        void finish( Launch const & launch )
+        {
+            float milliseconds = 0.0f;
+            CUDA_CHECK( cudaEventElapsedTime( &milliseconds, launch.start, launch.stop ) );
+            m_freeEvents.push_back( launch.start );
+            m_freeEvents.push_back( launch.stop );
+
+            Statistics & stats = m_statistics[ launch.kernelId ];
+            ++stats.numCalls;
+            stats.totalTime += milliseconds;
+            stats.minTime = std::min( stats.minTime, double( milliseconds ) );
+            stats.maxTime = std::max( stats.maxTime, double( milliseconds ) );
+            stats.lastGridExtent = launch.gridExtent;
+            stats.lastBlockExtent = launch.blockExtent;
+            stats.lastSharedMemByte = launch.sharedMemByte;
+
+            if( m_trace.size() < m_maxTraceEvents )
+                m_trace.push_back( TraceEvent{ launch, double( milliseconds ) } );
+            else
+                ++m_numDroppedTraceEvents;
+        }
+
+        /** write the summary and the trace, release all events and disable the profiler
+         *
+         * All profiled kernels must be finished.
+         *
+         * @param prefix file name prefix, `<prefix>_<rank>.txt` and `<prefix>_<rank>.json` are written
+         * @param rank rank of the process
+         */
+        void dump(
+            std::string const & prefix,
+            int const rank
+        )
+        {
+            std::string const fileName = prefix + "_" + std::to_string( rank );
+            writeSummary( fileName + ".txt" );
+            writeTrace( fileName + ".json", rank );
+            m_isEnabled = false;
+
+            for( auto & event : m_freeEvents )
+                CUDA_CHECK( cudaEventDestroy( event ) );
+            m_freeEvents.clear();
+        }
+
+    private:
+
+        using Clock = std::chrono::steady_clock;
+
+        struct Statistics
+        {
+            std::string name;
+            std::string location;
+            uint64_t numCalls = 0u;
+            double totalTime = 0.0;
+            double minTime = std::numeric_limits< double >::max();
+            double maxTime = 0.0;
+            DataSpace< DIM3 > lastGridExtent;
+            DataSpace< DIM3 > lastBlockExtent;
+            size_t lastSharedMemByte = 0u;
+        };
+
+        struct TraceEvent
+        {
+            Launch launch;
+            double duration;
+        };
+
+        KernelProfiler() = default;
+
+        size_t getKernelId(
+            char const * mangledName,
+            std::string const & location
+        )
+        {
+            std::string const key = std::string( mangledName ) + location;
+            auto id = m_kernelIds.find( key );
+            if( id != m_kernelIds.end() )
+                return id->second;
+
+            Statistics stats;
+            stats.name = demangle( mangledName );
+            stats.location = location;
+            m_statistics.push_back( stats );
+            size_t const newId = m_statistics.size() - 1u;
+            m_kernelIds[ key ] = newId;
+            return newId;
+        }
+
+        cudaEvent_t createEvent()
+        {
+            if( !m_freeEvents.empty() )
+            {
+                cudaEvent_t event = m_freeEvents.back();
+                m_freeEvents.pop_back();
+                return event;
+            }
+            cudaEvent_t event;
+            CUDA_CHECK( cudaEventCreate( &event ) );
+            return event;
+        }
+
+        static std::string demangle( char const * mangledName )
+        {
+#if defined(__GNUC__)
+            int status = 0;
+            char * name = abi::__cxa_demangle( mangledName, nullptr, nullptr, &status );
+            if( status == 0 && name != nullptr )
+            {
+                std::string const result( name );
+                std::free( name );
+                return result;
+            }
+#endif
+            return std::string( mangledName );
+        }
+
+        static std::string escapeJson( std::string const & value )
+        {
+            std::string result;
+            for( char const c : value )
+            {
+                if( c == '"' || c == '\\' )
+                    result += '\\';
+                result += c;
+            }
+            return result;
+        }
+
+        void writeSummary( std::string const & fileName ) const
+        {
+            std::ofstream file( fileName.c_str() );
+            if( !file )
+                throw std::runtime_error( std::string( "KernelProfiler: can not open file " ) + fileName );
+
+            std::vector< size_t > order( m_statistics.size() );
+            for( size_t i = 0u; i < order.size(); ++i )
+                order[ i ] = i;
+            std::sort(
+                order.begin(),
+                order.end(),
+                [ this ]( size_t const a, size_t const b )
+                {
+                    return m_statistics[ a ].totalTime > m_statistics[ b ].totalTime;
+                }
+            );
+
+            file << "# total[ms] calls avg[ms] min[ms] max[ms] grid block sharedMem[byte] kernel location" << std::endl;
+            for( size_t const i : order )
+            {
+                Statistics const & stats = m_statistics[ i ];
+                if( stats.numCalls == 0u )
+                    continue;
+                file << std::setprecision( 6 ) << stats.totalTime << " "
+                     << stats.numCalls << " "
+                     << stats.totalTime / double( stats.numCalls ) << " "
+                     << stats.minTime << " "
+                     << stats.maxTime << " "
+                     << stats.lastGridExtent.toString( ",", "()" ) << " "
+                     << stats.lastBlockExtent.toString( ",", "()" ) << " "
+                     << stats.lastSharedMemByte << " "
+                     << stats.name << " "
+                     << stats.location << std::endl;
+            }
+            if( m_numDroppedTraceEvents != 0u )
+                file << "# " << m_numDroppedTraceEvents << " launches are not contained in the trace" << std::endl;
+        }
+
+        void writeTrace(
+            std::string const & fileName,
+            int const rank
+        ) const
+        {
+            std::ofstream file( fileName.c_str() );
+            if( !file )
+                throw std::runtime_error( std::string( "KernelProfiler: can not open file " ) + fileName );
+
+            file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+            bool isFirst = true;
+            for( auto const & event : m_trace )
+            {
+                Statistics const & stats = m_statistics[ event.launch.kernelId ];
+                if( !isFirst )
+                    file << ",";
+                isFirst = false;
+                file << std::endl << std::fixed << std::setprecision( 3 )
+                     << "{\"name\":\"" << escapeJson( stats.name ) << "\""
+                     << ",\"cat\":\"kernel\",\"ph\":\"X\""
+                     << ",\"pid\":" << rank << ",\"tid\":0"
+                     << ",\"ts\":" << event.launch.launchTime
+                     << ",\"dur\":" << event.duration * 1000.0
+                     << ",\"args\":{\"grid\":\"" << event.launch.gridExtent.toString( ",", "()" ) << "\""
+                     << ",\"block\":\"" << event.launch.blockExtent.toString( ",", "()" ) << "\""
+                     << ",\"sharedMem\":" << event.launch.sharedMemByte
+                     << ",\"location\":\"" << escapeJson( stats.location ) << "\"}}";
+            }
+            file << std::endl << "]}" << std::endl;
+        }
+
+        bool m_isEnabled = false;
+        size_t m_maxTraceEvents = 0u;
+        uint64_t m_numDroppedTraceEvents = 0u;
+        Clock::time_point m_startTime;
+        std::map< std::string, size_t > m_kernelIds;
+        std::vector< Statistics > m_statistics;
+        std::vector< TraceEvent > m_trace;
+        std::vector< cudaEvent_t > m_freeEvents;
+    };
+
+} // namespace pmacc
@@ -25,6 +25,9 @@
 
 #include "pmacc/eventSystem/tasks/StreamTask.hpp"
 #include "pmacc/eventSystem/streams/EventStream.hpp"
+#include "pmacc/eventSystem/tasks/KernelProfiler.hpp"
+
+#include <memory>
 
 namespace pmacc
 {
@@ -42,6 +45,8 @@ namespace pmacc
 
         virtual ~TaskKernel()
         {
+            if(profilerLaunch)
+                KernelProfiler::getInstance().finish(*profilerLaunch);
             notify(this->myId, KERNEL, nullptr);
         }
 
@@ -60,6 +65,15 @@ namespace pmacc
 
         void activateChecks();
 
+        /** attach the profiler events of the kernel
+         *
+         * The duration is accounted in the KernelProfiler when the task is finished.
+         */
+        void setProfilerLaunch(KernelProfiler::Launch const & launch)
+        {
+            profilerLaunch.reset(new KernelProfiler::Launch(launch));
+        }
+
         virtual std::string toString()
         {
             return std::string("TaskKernel ") + kernelName;
@@ -72,6 +86,7 @@ namespace pmacc
     private:
         bool canBeChecked;
         std::string kernelName;
+        std::unique_ptr<KernelProfiler::Launch> profilerLaunch;
     };
 
 } //namespace pmacc
@@ -27,6 +27,7 @@
 #include "pmacc/mappings/simulation/EnvironmentController.hpp"
 #include "pmacc/communication/CommunicatorMPI.hpp"
 #include "pmacc/mappings/simulation/SubGrid.hpp"
+#include "pmacc/eventSystem/tasks/ITask.hpp"
 
 namespace pmacc
 {
@@ -167,8 +168,11 @@ namespace pmacc
              */
             bool slide()
             {
-               /* wait that all tasks are finished */
-               Environment<DIM>::get().Manager().waitForAllTasks();//
+               /* the slide changes the neighbors of this rank: finish all
+                * communication with the old neighbors, tasks which do not
+                * communicate (kernels, copies) are not affected and keep running
+                */
+               Environment<DIM>::get().Manager().waitForAllTasks(ITask::TASK_MPI);
 
                bool result = comm.slide();
 
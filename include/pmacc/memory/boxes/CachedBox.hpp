@@ -25,6 +25,7 @@
 #include "pmacc/types.hpp"
 #include "pmacc/memory/boxes/DataBox.hpp"
 #include "pmacc/memory/boxes/SharedBox.hpp"
+#include "pmacc/memory/boxes/SharedBoxSoA.hpp"
 
 
 namespace pmacc
@@ -55,6 +56,29 @@ namespace pmacc
             }
 
         };
+
+        template< typename T_ValueType, class T_BlockDescription, uint32_t T_Id>
+        class CachedBoxSoA
+        {
+        public:
+            typedef T_BlockDescription BlockDescription;
+            typedef T_ValueType ValueType;
+        private:
+            typedef typename BlockDescription::FullSuperCellSize FullSuperCellSize;
+            typedef typename BlockDescription::OffsetOrigin OffsetOrigin;
+
+        public:
+            typedef DataBox<SharedBoxSoA<ValueType, FullSuperCellSize, T_Id> > Type;
+
+            template< typename T_Acc >
+            HDINLINE static Type create( T_Acc const & acc )
+            {
+                DataSpace<OffsetOrigin::dim> offset(OffsetOrigin::toRT());
+                Type c_box(Type::init( acc ));
+                return c_box.shift(offset);
+            }
+
+        };
     }
 
     struct CachedBox
@@ -76,4 +100,29 @@ namespace pmacc
 
     };
 
+    /** cache with one contiguous plane per vector component
+     *
+     * Drop-in replacement for CachedBox, ValueType must be a pmacc::math::Vector.
+     * Neighboring cells of the same component are adjacent in memory which
+     * allows unit stride (vectorized) loads in stencil operations.
+     */
+    struct CachedBoxSoA
+    {
+
+        template<uint32_t Id_, typename ValueType_, class BlockDescription_, typename T_Acc >
+        DINLINE static typename intern::CachedBoxSoA<ValueType_, BlockDescription_, Id_ >::Type
+        create( T_Acc const & acc, const ValueType_& value, const BlockDescription_ block )
+        {
+            return intern::CachedBoxSoA<ValueType_, BlockDescription_, Id_>::create( acc );
+        }
+
+        template< uint32_t Id_, typename ValueType_, class BlockDescription_, typename T_Acc >
+        DINLINE static typename intern::CachedBoxSoA<ValueType_, BlockDescription_, Id_ >::Type
+        create( T_Acc const & acc, const BlockDescription_ block )
+        {
+            return intern::CachedBoxSoA<ValueType_, BlockDescription_, Id_>::create( acc );
+        }
+
+    };
+
 }
@@ -0,0 +1,345 @@
+/* Copyright 2018 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/memory/shared/Allocate.hpp"
+#include "pmacc/memory/Array.hpp"
+#include "pmacc/types.hpp"
+
+#include "pmacc/math/Vector.hpp"
+
+
+namespace pmacc
+{
+namespace sharedBoxSoA
+{
+
+    /** vector storage policy for components stored in separate planes
+     *
+     * Component `i` is located `i * T_planeSize` elements behind component 0.
+     * A vector with this storage is never created, it is only used as
+     * reference into memory with structure of arrays layout.
+     *
+     * @tparam T_planeSize number of elements between two components
+     */
+    template< uint32_t T_planeSize >
+    struct PlaneStorage
+    {
+        template< typename T_Type, int T_dim >
+        struct Storage
+        {
+            static constexpr bool isConst = false;
+            static constexpr int dim = T_dim;
+            typedef T_Type type;
+
+            type v[ ( dim - 1 ) * T_planeSize + 1 ];
+
+            HDINLINE
+            type& operator[]( const int idx )
+            {
+                return v[ idx * T_planeSize ];
+            }
+
+            HDINLINE
+            const type& operator[]( const int idx ) const
+            {
+                return v[ idx * T_planeSize ];
+            }
+        };
+    };
+
+    /** reference type to a vector stored in planes
+     *
+     * @tparam T_Vector pmacc::math::Vector, type of the stored vector
+     * @tparam T_planeSize number of elements between two components
+     */
+    template< typename T_Vector, uint32_t T_planeSize >
+    struct PlaneVector
+    {
+        typedef math::Vector<
+            typename T_Vector::type,
+            T_Vector::dim,
+            math::StandardAccessor,
+            math::StandardNavigator,
+            PlaneStorage< T_planeSize >::template Storage
+        > type;
+    };
+
+} // namespace sharedBoxSoA
+
+/** create shared memory on gpu with one plane per vector component
+ *
+ * Same interface as SharedBox but all x components are stored contiguously,
+ * followed by all y components and so on (structure of arrays).
+ * Reading an element returns a pmacc::math::Vector reference, therefore
+ * all vector operations and component accessors can be used as usual.
+ *
+ * @tparam T_Vector pmacc::math::Vector, type of the memory objects
+ * @tparam T_Size CT::Vector with size description (per dimension)
+ * @tparam T_id unique id for this object
+ *              (is needed if more than one instance of shared memory in one kernel is used)
+ * @tparam T_planeSize number of elements per component plane
+ * @tparam T_dim dimension of the memory (supports DIM1,DIM2 and DIM3)
+ */
+template<
+    typename T_Vector,
+    class T_Size,
+    uint32_t T_id = 0,
+    uint32_t T_planeSize = math::CT::volume< T_Size >::type::value,
+    uint32_t T_dim = T_Size::dim
+>
+class SharedBoxSoA;
+
+template< typename T_Vector, class T_Size, uint32_t T_id, uint32_t T_planeSize >
+class SharedBoxSoA< T_Vector, T_Size, T_id, T_planeSize, DIM1 >
+{
+public:
+
+    enum
+    {
+        Dim = DIM1
+    };
+    typedef T_Vector ValueType;
+    typedef typename sharedBoxSoA::PlaneVector< ValueType, T_planeSize >::type PlaneVector;
+    typedef PlaneVector& RefValueType;
+    typedef T_Size Size;
+    typedef SharedBoxSoA< ValueType, math::CT::Int< Size::x::value >, T_id, T_planeSize > ReducedType;
+    typedef SharedBoxSoA< ValueType, T_Size, T_id, T_planeSize, DIM1 > This;
+
+    HDINLINE RefValueType operator[]( const int idx )
+    {
+        return *shiftPointer( fixedPointer, idx );
+    }
+
+    HDINLINE RefValueType operator[]( const int idx ) const
+    {
+        return *shiftPointer( fixedPointer, idx );
+    }
+
+    HDINLINE SharedBoxSoA( PlaneVector* pointer = nullptr ) :
+        fixedPointer( pointer )
+    {
+    }
+
+    /*!return the first value in the box (list)
+     * @return first value
+     */
+    HDINLINE RefValueType operator*()
+    {
+        return *fixedPointer;
+    }
+
+    HDINLINE PlaneVector const * getPointer() const
+    {
+        return fixedPointer;
+    }
+    HDINLINE PlaneVector* getPointer()
+    {
+        return fixedPointer;
+    }
+
+    /** pointer to the element with a linear offset of idx to pointer */
+    static HDINLINE PlaneVector* shiftPointer( PlaneVector* pointer, const int idx )
+    {
+        return reinterpret_cast< PlaneVector* >(
+            reinterpret_cast< typename ValueType::type* >( pointer ) + idx
+        );
+    }
+
+    /** create a shared memory box
+     *
+     * This call synchronizes a block and must be called from all threads and
+     * not inside a if clauses
+     */
+    template< typename T_Acc >
+    static DINLINE SharedBoxSoA
+    init( T_Acc const & acc )
+    {
+        auto& mem_sh = pmacc::memory::shared::allocate<
+            T_id,
+            memory::Array<
+                typename ValueType::type,
+                T_planeSize * ValueType::dim
+            >
+        >( acc );
+        return SharedBoxSoA( reinterpret_cast< PlaneVector* >( mem_sh.data() ) );
+    }
+
+protected:
+
+    PMACC_ALIGN( fixedPointer, PlaneVector* );
+};
+
+template< typename T_Vector, class T_Size, uint32_t T_id, uint32_t T_planeSize >
+class SharedBoxSoA< T_Vector, T_Size, T_id, T_planeSize, DIM2 >
+{
+public:
+
+    enum
+    {
+        Dim = DIM2
+    };
+    typedef T_Vector ValueType;
+    typedef typename sharedBoxSoA::PlaneVector< ValueType, T_planeSize >::type PlaneVector;
+    typedef PlaneVector& RefValueType;
+    typedef T_Size Size;
+    typedef SharedBoxSoA< ValueType, math::CT::Int< Size::x::value >, T_id, T_planeSize > ReducedType;
+    typedef SharedBoxSoA< ValueType, T_Size, T_id, T_planeSize, DIM2 > This;
+
+    HDINLINE SharedBoxSoA( PlaneVector* pointer = nullptr ) :
+        fixedPointer( pointer )
+    {
+    }
+
+    HDINLINE ReducedType operator[]( const int idx )
+    {
+        return ReducedType( ReducedType::shiftPointer( fixedPointer, idx * Size::x::value ) );
+    }
+
+    HDINLINE ReducedType operator[]( const int idx ) const
+    {
+        return ReducedType( ReducedType::shiftPointer( fixedPointer, idx * Size::x::value ) );
+    }
+
+    /*!return the first value in the box (list)
+     * @return first value
+     */
+    HDINLINE RefValueType operator*()
+    {
+        return *fixedPointer;
+    }
+
+    HDINLINE PlaneVector const * getPointer() const
+    {
+        return fixedPointer;
+    }
+    HDINLINE PlaneVector* getPointer()
+    {
+        return fixedPointer;
+    }
+
+    /** create a shared memory box
+     *
+     * This call synchronizes a block and must be called from all threads and
+     * not inside a if clauses
+     */
+    template< typename T_Acc >
+    static DINLINE SharedBoxSoA
+    init( T_Acc const & acc )
+    {
+        auto& mem_sh = pmacc::memory::shared::allocate<
+            T_id,
+            memory::Array<
+                typename ValueType::type,
+                T_planeSize * ValueType::dim
+            >
+        >( acc );
+        return SharedBoxSoA( reinterpret_cast< PlaneVector* >( mem_sh.data() ) );
+    }
+
+protected:
+
+    PMACC_ALIGN( fixedPointer, PlaneVector* );
+};
+
+template< typename T_Vector, class T_Size, uint32_t T_id, uint32_t T_planeSize >
+class SharedBoxSoA< T_Vector, T_Size, T_id, T_planeSize, DIM3 >
+{
+public:
+
+    enum
+    {
+        Dim = DIM3
+    };
+    typedef T_Vector ValueType;
+    typedef typename sharedBoxSoA::PlaneVector< ValueType, T_planeSize >::type PlaneVector;
+    typedef PlaneVector& RefValueType;
+    typedef T_Size Size;
+    typedef SharedBoxSoA<
+        ValueType,
+        math::CT::Int< Size::x::value, Size::y::value >,
+        T_id,
+        T_planeSize
+    > ReducedType;
+    typedef SharedBoxSoA< ValueType, T_Size, T_id, T_planeSize, DIM3 > This;
+
+    HDINLINE SharedBoxSoA( PlaneVector* pointer = nullptr ) :
+        fixedPointer( pointer )
+    {
+    }
+
+    HDINLINE ReducedType operator[]( const int idx )
+    {
+        return ReducedType(
+            ReducedType::ReducedType::shiftPointer( fixedPointer, idx * ( Size::x::value * Size::y::value ) )
+        );
+    }
+
+    HDINLINE ReducedType operator[]( const int idx ) const
+    {
+        return ReducedType(
+            ReducedType::ReducedType::shiftPointer( fixedPointer, idx * ( Size::x::value * Size::y::value ) )
+        );
+    }
+
+    /*!return the first value in the box (list)
+     * @return first value
+     */
+    HDINLINE RefValueType operator*()
+    {
+        return *fixedPointer;
+    }
+
+    HDINLINE PlaneVector const * getPointer() const
+    {
+        return fixedPointer;
+    }
+    HDINLINE PlaneVector* getPointer()
+    {
+        return fixedPointer;
+    }
+
+    /** create a shared memory box
+     *
+     * This call synchronizes a block and must be called from all threads and
+     * not inside a if clauses
+     */
+    template< typename T_Acc >
+    static DINLINE SharedBoxSoA
+    init( T_Acc const & acc )
+    {
+        auto& mem_sh = pmacc::memory::shared::allocate<
+            T_id,
+            memory::Array<
+                typename ValueType::type,
+                T_planeSize * ValueType::dim
+            >
+        >( acc );
+        return SharedBoxSoA( reinterpret_cast< PlaneVector* >( mem_sh.data() ) );
+    }
+
+protected:
+
+    PMACC_ALIGN( fixedPointer, PlaneVector* );
+};
+
+} // namespace pmacc
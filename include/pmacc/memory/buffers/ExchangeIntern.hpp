@@ -34,6 +34,7 @@
 #include "pmacc/types.hpp"
 
 #include <memory>
+#include <stdexcept>
 
 
 namespace pmacc
@@ -49,7 +50,9 @@ namespace pmacc
 
         ExchangeIntern(DeviceBuffer<TYPE, DIM>& source, GridLayout<DIM> memoryLayout, DataSpace<DIM> guardingCells, uint32_t exchange,
                        uint32_t communicationTag, uint32_t area = BORDER, bool sizeOnDevice = false) :
-        Exchange<TYPE, DIM>(exchange, communicationTag)
+        Exchange<TYPE, DIM>(exchange, communicationTag),
+        sizeOnDevice(sizeOnDevice),
+        hasDedicatedMemory(false)
         {
 
             PMACC_ASSERT(!guardingCells.isOneDimensionGreaterThan(memoryLayout.getGuard()));
@@ -93,17 +96,31 @@ namespace pmacc
 
         ExchangeIntern(DataSpace<DIM> exchangeDataSpace, uint32_t exchange,
                        uint32_t communicationTag, bool sizeOnDevice = false) :
-        Exchange<TYPE, DIM>(exchange, communicationTag)
+        Exchange<TYPE, DIM>(exchange, communicationTag),
+        sizeOnDevice(sizeOnDevice),
+        hasDedicatedMemory(true)
         {
-            deviceBuffer.reset( new DeviceBufferIntern<TYPE, DIM > (exchangeDataSpace, sizeOnDevice) );
-           //  this->deviceBuffer = new DeviceBufferIntern<TYPE, DIM > (exchangeDataSpace, sizeOnDevice,true);
-            if (DIM > DIM1)
-            {
-                /*create double buffer on gpu for faster memory transfers*/
-               deviceDoubleBuffer.reset( new DeviceBufferIntern<TYPE, DIM > (exchangeDataSpace, false, true) );
-            }
+            createBuffers(exchangeDataSpace);
+        }
 
-            hostBuffer.reset( new HostBufferIntern<TYPE, DIM > (exchangeDataSpace) );
+        /**
+         * Replace the memory of an exchange with dedicated memory.
+         *
+         * The content of the buffers is not preserved.
+         * Must not be called while a transfer of this exchange is in flight.
+         *
+         * @param exchangeDataSpace new size of the exchange buffer in each dimension
+         */
+        void resize(DataSpace<DIM> exchangeDataSpace)
+        {
+            if (!hasDedicatedMemory)
+                throw std::runtime_error("Only exchanges with dedicated memory can be resized");
+
+            /* release the old memory first to allow growing into it */
+            hostBuffer.reset();
+            deviceDoubleBuffer.reset();
+            deviceBuffer.reset();
+            createBuffers(exchangeDataSpace);
         }
 
         /**
@@ -232,6 +249,23 @@ namespace pmacc
         }
 
     protected:
+
+        void createBuffers(DataSpace<DIM> exchangeDataSpace)
+        {
+            deviceBuffer.reset( new DeviceBufferIntern<TYPE, DIM > (exchangeDataSpace, sizeOnDevice) );
+            if (DIM > DIM1)
+            {
+                /*create double buffer on gpu for faster memory transfers*/
+               deviceDoubleBuffer.reset( new DeviceBufferIntern<TYPE, DIM > (exchangeDataSpace, false, true) );
+            }
+
+            hostBuffer.reset( new HostBufferIntern<TYPE, DIM > (exchangeDataSpace) );
+        }
+
+        bool sizeOnDevice;
+        //! false if the device buffer is a view to the memory of a GridBuffer
+        bool hasDedicatedMemory;
+
         std::unique_ptr< HostBufferIntern<TYPE, DIM> > hostBuffer;
 
         //! This buffer is a vector which is used as message buffer for faster memcopy
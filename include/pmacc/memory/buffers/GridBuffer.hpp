@@ -356,6 +356,33 @@ public:
         addExchangeBuffer( receive, dataSpace, communicationTag, sizeOnDevice, sizeOnDevice );
     }
 
+    /**
+     * Resize the dedicated memory of the Exchange for sending in ex direction.
+     *
+     * The receiving neighbor must resize its matching receive Exchange
+     * to the same size. The content of the buffers is not preserved.
+     *
+     * @param ex exchange direction
+     * @param dataSpace new size of the exchange buffer in each dimension
+     */
+    void resizeSendExchangeBuffer(uint32_t ex, const DataSpace<DIM> &dataSpace)
+    {
+        sendExchanges[ex]->resize(dataSpace);
+    }
+
+    /**
+     * Resize the dedicated memory of the Exchange for receiving from ex direction.
+     *
+     * @see resizeSendExchangeBuffer
+     *
+     * @param ex exchange direction
+     * @param dataSpace new size of the exchange buffer in each dimension
+     */
+    void resizeReceiveExchangeBuffer(uint32_t ex, const DataSpace<DIM> &dataSpace)
+    {
+        receiveExchanges[ex]->resize(dataSpace);
+    }
+
     /**
      * Returns whether this GridBuffer has an Exchange for sending in ex direction.
      *
@@ -23,6 +23,7 @@
 
 #include "pmacc/communication/manager_common.hpp"
 #include "pmacc/mpi/reduceMethods/AllReduce.hpp"
+#include "pmacc/mpi/reduceMethods/Reduce.hpp"
 #include "pmacc/mpi/GetMPI_StructAsArray.hpp"
 #include "pmacc/mpi/GetMPI_Op.hpp"
 #include "pmacc/assert.hpp"
@@ -186,6 +187,43 @@ struct MPIReduce
         this->operator ()(func, dest, src, n, ::pmacc::mpi::reduceMethods::AllReduce());
     }
 
+    /* Start a reduction of elements on cpu memory to a single rank
+     *
+     * The result is stored on the rank for which hasResult(reduceMethods::Reduce())
+     * is true. The reduction is non-blocking if the MPI library supports
+     * MPI-3 collectives, else the data is reduced before the function returns.
+     * dest and src must not be accessed before the returned request is
+     * completed e.g. with MPI_Wait.
+     *
+     * @param func binary functor for reduce, must specialize the function getMPI_Op
+     * @param dest buffer for result data
+     * @param src pointer to the elements to reduce
+     * @param n number of elements to reduce
+     * @return request of the reduction, MPI_REQUEST_NULL if the reduction is finished
+     */
+    template<class Functor, typename Type >
+    HINLINE MPI_Request startReduce(Functor func,
+                                    Type* dest,
+                                    Type* src,
+                                    const size_t n)
+    {
+        if (!isMPICommInitialized)
+            participate(true);
+
+        MPI_Request request = MPI_REQUEST_NULL;
+#if (MPI_VERSION >= 3)
+        MPI_CHECK(MPI_Ireduce((void*) src,
+                              (void*) dest,
+                              n * ::pmacc::mpi::getMPI_StructAsArray<Type > ().sizeMultiplier,
+                              ::pmacc::mpi::getMPI_StructAsArray<Type > ().dataType,
+                              ::pmacc::mpi::getMPI_Op<Functor > (),
+                              0, comm, &request));
+#else
+        this->operator ()(func, dest, src, n, ::pmacc::mpi::reduceMethods::Reduce());
+#endif
+        return request;
+    }
+
 
 private:
 
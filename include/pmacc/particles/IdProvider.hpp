@@ -118,6 +118,25 @@ namespace pmacc
         return static_cast<uint64_t>(nvidia::atomicAllInc(&idDetail::nextId));
     }
 
+    template<unsigned T_dim>
+    HDINLINE uint64_t IdProvider<T_dim>::reserveIds(uint64_t numIds)
+    {
+        // use the same atomic implementation as nvidia::atomicAllInc() in getNewId()
+#ifdef __CUDA_ARCH__
+        alpaka::atomic::AtomicCudaBuiltIn atomicImpl;
+#else
+        alpaka::atomic::AtomicStlLock<16> atomicImpl;
+#endif
+        return static_cast<uint64_t>(
+            ::alpaka::atomic::atomicOp< ::alpaka::atomic::op::Add >(
+                atomicImpl,
+                &idDetail::nextId,
+                static_cast<uint64_cu>(numIds),
+                ::alpaka::hierarchy::Grids()
+            )
+        );
+    }
+
     template<unsigned T_dim>
     bool IdProvider<T_dim>::isOverflown()
     {
@@ -169,6 +169,15 @@ public:
     template<uint32_t T_area>
     void deleteParticlesInArea();
 
+    /** sort the particles of each supercell in an area by their cell
+     *
+     * Afterwards all frames except the last of a supercell are fully filled.
+     *
+     * @tparam T_area area which is used (CORE,BORDER,GUARD or a combination)
+     */
+    template<uint32_t T_area>
+    void sortParticlesByCell();
+
     /** copy guard particles to intermediate exchange buffer
      *
      * Copy all particles from the guard of a direction to the device exchange buffer.
@@ -73,6 +73,26 @@ namespace pmacc
         );
     }
 
+    template<typename T_ParticleDescription, class MappingDesc, typename T_DeviceHeap>
+    template<uint32_t T_area>
+    void ParticlesBase<T_ParticleDescription, MappingDesc, T_DeviceHeap>::sortParticlesByCell()
+    {
+
+        AreaMapping<T_area, MappingDesc> mapper(this->cellDescription);
+
+        constexpr uint32_t numWorkers = traits::GetNumWorkers<
+            math::CT::volume< typename FrameType::SuperCellSize >::type::value
+        >::value;
+
+        PMACC_KERNEL( KernelSortParticlesByCell< numWorkers >{ } )(
+            mapper.getGridDim( ),
+            numWorkers
+        )(
+            particlesBuffer->getDeviceParticleBox( ),
+            mapper
+        );
+    }
+
     template<typename T_ParticleDescription, class MappingDesc, typename T_DeviceHeap>
     void ParticlesBase<T_ParticleDescription, MappingDesc, T_DeviceHeap>::reset(uint32_t )
     {
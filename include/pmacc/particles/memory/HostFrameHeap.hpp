@@ -0,0 +1,399 @@
+/* Copyright 2018 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace pmacc
+{
+
+    /** frame heap for CPU accelerators
+     *
+     * Counterpart of the mallocMC `DeviceHeap` for accelerators where the
+     * particle frames live in host memory. The heap reserves one contiguous
+     * memory region and carves fixed size blocks out of it. Freed blocks are
+     * recycled via free lists, one per frame size (size class).
+     *
+     * The allocation and release of a frame is lock-free: each host thread
+     * holds a private free list per size class. Only if a thread collects
+     * more than `2 * cacheBatchSize` free blocks (or has none left) a batch
+     * of `cacheBatchSize` blocks is moved to (from) a shared list which is
+     * protected by a mutex.
+     *
+     * The interface follows `mallocMC::Allocator` so that `ParticlesBox` can
+     * handle both heaps in the same way.
+     */
+    class HostFrameHeap
+    {
+    public:
+
+        //! maximum number of different frame sizes
+        static constexpr uint32_t maxSizeClasses = 16u;
+        //! alignment of each frame in byte (one cache line)
+        static constexpr size_t alignment = 64u;
+        //! number of free blocks moved between a thread and the shared list
+        static constexpr uint32_t cacheBatchSize = 32u;
+
+        /** handle which is copied into the `ParticlesBox` */
+        struct AllocatorHandle
+        {
+            HostFrameHeap* heap;
+
+            HINLINE AllocatorHandle( HostFrameHeap* const heapPtr = nullptr ) :
+                heap( heapPtr )
+            {
+            }
+
+            /** allocate memory
+             *
+             * @param size size in byte
+             * @return pointer to the memory, nullptr if the heap is exhausted
+             */
+            HINLINE void* malloc( size_t const size ) const
+            {
+                return heap->malloc( size );
+            }
+
+            /** free memory allocated with `malloc()`
+             *
+             * @param ptr pointer to the memory, nullptr is allowed
+             */
+            HINLINE void free( void* const ptr ) const
+            {
+                heap->free( ptr );
+            }
+        };
+
+        /** create a heap
+         *
+         * @param size number of bytes reserved for the heap
+         */
+        HostFrameHeap( size_t const size = 0u )
+        {
+            destructiveResize( size );
+        }
+
+        HostFrameHeap( HostFrameHeap const & ) = delete;
+        HostFrameHeap& operator=( HostFrameHeap const & ) = delete;
+
+        /** resize the heap
+         *
+         * All memory which is allocated with the heap is invalid after this call.
+         * The memory is only reserved, the operating system maps pages lazily
+         * if a frame is used the first time.
+         *
+         * @param size number of bytes reserved for the heap
+         */
+        void destructiveResize( size_t const size )
+        {
+            m_memory.reset( size != 0u ? new uint8_t[ size + alignment ] : nullptr );
+            m_begin = reinterpret_cast< uint8_t* >(
+                ( reinterpret_cast< size_t >( m_memory.get( ) ) + alignment - 1u ) / alignment * alignment
+            );
+            m_capacity = size;
+            m_offset = 0u;
+            for( uint32_t i = 0u; i < maxSizeClasses; ++i )
+            {
+                m_sizeClasses[ i ].blockSize = 0u;
+                m_sizeClasses[ i ].numCarvedBlocks = 0u;
+                m_sizeClasses[ i ].sharedFreeList = nullptr;
+                m_sizeClasses[ i ].numSharedFree = 0u;
+            }
+            // invalidate all thread private free lists
+            m_epoch = nextEpoch( )++;
+        }
+
+        AllocatorHandle getAllocatorHandle( )
+        {
+            return AllocatorHandle( this );
+        }
+
+        /** number of blocks of the given size which can be allocated
+         *
+         * Blocks cached in thread private free lists are not counted.
+         *
+         * @param size size in byte of one block
+         */
+        size_t getAvailableSlots( size_t const size )
+        {
+            size_t const blockSize = getBlockSize( size );
+            size_t const offset = m_offset.load( std::memory_order_relaxed );
+            size_t numSlots = offset < m_capacity ? ( m_capacity - offset ) / blockSize : 0u;
+
+            int const sizeClassIdx = findSizeClass( blockSize );
+            if( sizeClassIdx >= 0 )
+            {
+                numSlots += m_sizeClasses[ sizeClassIdx ].numSharedFree.load( std::memory_order_relaxed );
+            }
+            return numSlots;
+        }
+
+        /** maximum number of blocks of the given size which were in use at the same time
+         *
+         * @param size size in byte of one block
+         */
+        size_t getHighWaterSlots( size_t const size )
+        {
+            int const sizeClassIdx = findSizeClass( getBlockSize( size ) );
+            return sizeClassIdx >= 0 ?
+                m_sizeClasses[ sizeClassIdx ].numCarvedBlocks.load( std::memory_order_relaxed ) :
+                0u;
+        }
+
+        //! maximum number of bytes of the reserved memory used at the same time
+        size_t getHighWaterBytes( ) const
+        {
+            size_t const offset = m_offset.load( std::memory_order_relaxed );
+            return offset < m_capacity ? offset : m_capacity;
+        }
+
+        //! number of bytes reserved for the heap
+        size_t getCapacity( ) const
+        {
+            return m_capacity;
+        }
+
+        /** allocate memory
+         *
+         * @param size size in byte
+         * @return pointer to the memory, nullptr if the heap is exhausted
+         */
+        void* malloc( size_t const size )
+        {
+            size_t const blockSize = getBlockSize( size );
+            int const sizeClassIdx = getSizeClass( blockSize );
+            if( sizeClassIdx < 0 )
+                return nullptr;
+
+            ThreadCache& cache = getThreadCache( );
+            FreeBlock* block = cache.freeList[ sizeClassIdx ];
+            if( block == nullptr )
+            {
+                refill( cache, sizeClassIdx );
+                block = cache.freeList[ sizeClassIdx ];
+            }
+            if( block == nullptr )
+                block = carve( sizeClassIdx, blockSize );
+            else
+            {
+                cache.freeList[ sizeClassIdx ] = block->next;
+                --cache.numFree[ sizeClassIdx ];
+            }
+
+            if( block == nullptr )
+                return nullptr;
+            return reinterpret_cast< uint8_t* >( block ) + alignment;
+        }
+
+        /** free memory allocated with `malloc()`
+         *
+         * @param ptr pointer to the memory, nullptr is allowed
+         */
+        void free( void* const ptr )
+        {
+            if( ptr == nullptr )
+                return;
+
+            FreeBlock* block = reinterpret_cast< FreeBlock* >(
+                reinterpret_cast< uint8_t* >( ptr ) - alignment
+            );
+            uint32_t const sizeClassIdx = block->sizeClassIdx;
+
+            ThreadCache& cache = getThreadCache( );
+            block->next = cache.freeList[ sizeClassIdx ];
+            cache.freeList[ sizeClassIdx ] = block;
+            if( ++cache.numFree[ sizeClassIdx ] > 2u * cacheBatchSize )
+                spill( cache, sizeClassIdx );
+        }
+
+    private:
+
+        /** header of each block
+         *
+         * The header occupies the first `alignment` bytes of a block, the
+         * frame starts behind it. `next` is only valid while the block is free.
+         */
+        struct FreeBlock
+        {
+            FreeBlock* next;
+            uint32_t sizeClassIdx;
+        };
+
+        struct SizeClass
+        {
+            //! size in byte of one block including the header, zero if the class is unused
+            std::atomic< size_t > blockSize;
+            //! number of blocks taken from the reserved memory
+            std::atomic< size_t > numCarvedBlocks;
+            std::mutex mutex;
+            FreeBlock* sharedFreeList;
+            //! read without lock to skip empty shared lists
+            std::atomic< size_t > numSharedFree;
+        };
+
+        struct ThreadCache
+        {
+            uint64_t epoch = 0u;
+            FreeBlock* freeList[ maxSizeClasses ];
+            uint32_t numFree[ maxSizeClasses ];
+        };
+
+        static_assert(
+            sizeof( FreeBlock ) <= alignment,
+            "The block header must fit into the alignment."
+        );
+
+        //! unique id for each heap state, never zero
+        static std::atomic< uint64_t >& nextEpoch( )
+        {
+            static std::atomic< uint64_t > epoch( 1u );
+            return epoch;
+        }
+
+        static size_t getBlockSize( size_t const size )
+        {
+            return ( size + alignment - 1u ) / alignment * alignment + alignment;
+        }
+
+        /** get the thread private free lists of this heap
+         *
+         * The lists are reset if the thread used a different heap (or an
+         * older state of this heap) before.
+         */
+        ThreadCache& getThreadCache( ) const
+        {
+            static thread_local ThreadCache cache;
+            if( cache.epoch != m_epoch )
+            {
+                for( uint32_t i = 0u; i < maxSizeClasses; ++i )
+                {
+                    cache.freeList[ i ] = nullptr;
+                    cache.numFree[ i ] = 0u;
+                }
+                cache.epoch = m_epoch;
+            }
+            return cache;
+        }
+
+        int findSizeClass( size_t const blockSize )
+        {
+            for( uint32_t i = 0u; i < maxSizeClasses; ++i )
+            {
+                size_t const classSize = m_sizeClasses[ i ].blockSize.load( std::memory_order_acquire );
+                if( classSize == blockSize )
+                    return static_cast< int >( i );
+                if( classSize == 0u )
+                    break;
+            }
+            return -1;
+        }
+
+        /** find or register the size class for a block size
+         *
+         * @return index of the size class, -1 if all classes are in use
+         */
+        int getSizeClass( size_t const blockSize )
+        {
+            for( uint32_t i = 0u; i < maxSizeClasses; ++i )
+            {
+                size_t classSize = m_sizeClasses[ i ].blockSize.load( std::memory_order_acquire );
+                if( classSize == 0u )
+                {
+                    size_t unused = 0u;
+                    // if another thread registered a class in between `unused` holds its size
+                    if( m_sizeClasses[ i ].blockSize.compare_exchange_strong( unused, blockSize ) )
+                        return static_cast< int >( i );
+                    classSize = unused;
+                }
+                if( classSize == blockSize )
+                    return static_cast< int >( i );
+            }
+            return -1;
+        }
+
+        //! take a new block from the reserved memory
+        FreeBlock* carve( uint32_t const sizeClassIdx, size_t const blockSize )
+        {
+            size_t const offset = m_offset.fetch_add( blockSize, std::memory_order_relaxed );
+            if( offset + blockSize > m_capacity )
+                return nullptr;
+
+            m_sizeClasses[ sizeClassIdx ].numCarvedBlocks.fetch_add( 1u, std::memory_order_relaxed );
+            FreeBlock* block = reinterpret_cast< FreeBlock* >( m_begin + offset );
+            block->sizeClassIdx = sizeClassIdx;
+            return block;
+        }
+
+        //! move a batch of blocks from the thread private to the shared free list
+        void spill( ThreadCache& cache, uint32_t const sizeClassIdx )
+        {
+            FreeBlock* first = cache.freeList[ sizeClassIdx ];
+            FreeBlock* last = first;
+            for( uint32_t i = 1u; i < cacheBatchSize; ++i )
+                last = last->next;
+            cache.freeList[ sizeClassIdx ] = last->next;
+            cache.numFree[ sizeClassIdx ] -= cacheBatchSize;
+
+            SizeClass& sizeClass = m_sizeClasses[ sizeClassIdx ];
+            std::lock_guard< std::mutex > lock( sizeClass.mutex );
+            last->next = sizeClass.sharedFreeList;
+            sizeClass.sharedFreeList = first;
+            sizeClass.numSharedFree += cacheBatchSize;
+        }
+
+        //! move up to one batch of blocks from the shared to the thread private free list
+        void refill( ThreadCache& cache, uint32_t const sizeClassIdx )
+        {
+            SizeClass& sizeClass = m_sizeClasses[ sizeClassIdx ];
+            if( sizeClass.numSharedFree.load( std::memory_order_relaxed ) == 0u )
+                return;
+
+            std::lock_guard< std::mutex > lock( sizeClass.mutex );
+            uint32_t numBlocks = 0u;
+            while( sizeClass.sharedFreeList != nullptr && numBlocks < cacheBatchSize )
+            {
+                FreeBlock* block = sizeClass.sharedFreeList;
+                sizeClass.sharedFreeList = block->next;
+                block->next = cache.freeList[ sizeClassIdx ];
+                cache.freeList[ sizeClassIdx ] = block;
+                ++numBlocks;
+            }
+            sizeClass.numSharedFree -= numBlocks;
+            cache.numFree[ sizeClassIdx ] += numBlocks;
+        }
+
+        std::unique_ptr< uint8_t[] > m_memory;
+        uint8_t* m_begin = nullptr;
+        size_t m_capacity = 0u;
+        std::atomic< size_t > m_offset;
+        uint64_t m_epoch = 0u;
+        SizeClass m_sizeClasses[ maxSizeClasses ];
+    };
+
+} // namespace pmacc
@@ -96,11 +96,7 @@ public:
         const int maxTries = 13; //magic number is not performance critical
         for ( int numTries = 0; numTries < maxTries; ++numTries )
         {
-#if( PMACC_CUDA_ENABLED == 1 )
             tmp = (FrameType*) m_deviceHeapHandle.malloc( sizeof (FrameType) );
-#else
-            tmp = new FrameType;
-#endif
             if ( tmp != nullptr )
             {
                 /* disable all particles since we can not assume that newly allocated memory contains zeros */
@@ -114,7 +110,7 @@ public:
             }
             else
             {
-                printf( "%s: mallocMC out of memory (try %i of %i)\n",
+                printf( "%s: frame heap out of memory (try %i of %i)\n",
                         (numTries + 1) == maxTries ? "ERROR" : "WARNING",
                         numTries + 1,
                         maxTries );
@@ -132,11 +128,7 @@ public:
     template<typename T_InitMethod>
     DINLINE void removeFrame( FramePointer<FrameType, T_InitMethod>& frame )
     {
-#if( PMACC_CUDA_ENABLED == 1 )
         m_deviceHeapHandle.free( (void*) frame.ptr );
-#else
-        delete(frame.ptr);
-#endif
         frame.ptr = nullptr;
     }
 
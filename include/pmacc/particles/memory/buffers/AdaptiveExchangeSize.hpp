@@ -0,0 +1,179 @@
+/* Copyright 2018 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+
+namespace pmacc
+{
+
+    /** capacity policy for a particle exchange stack
+     *
+     * Tracks the number of particles transferred per exchange over a sliding
+     * window of exchanges and derives the stack capacity for the next
+     * exchange from the high-water mark of the window.
+     *
+     * A transfer round which fills the stack completely is followed by
+     * another round (see TaskSendParticlesExchange). The sender and the
+     * receiver of a direction therefore observe the same sequence of round
+     * sizes and derive the same capacity without any additional communication.
+     *
+     * - the stack grows as soon as an exchange needed more than one round
+     * - the stack shrinks only if the high-water mark of a full window needs
+     *   less than half of the current capacity
+     */
+    class AdaptiveExchangeSize
+    {
+    public:
+
+        /** create a policy which never changes the capacity
+         *
+         * @param capacity number of particles the stack can hold
+         */
+        AdaptiveExchangeSize( size_t capacity = 0u ) :
+            AdaptiveExchangeSize( capacity, capacity, capacity, 1u )
+        {
+        }
+
+        /** create an adaptive policy
+         *
+         * @param capacity initial number of particles the stack can hold
+         * @param minCapacity lower limit of the capacity
+         * @param maxCapacity upper limit of the capacity
+         * @param windowLength number of exchanges the high-water mark is taken over
+         */
+        AdaptiveExchangeSize(
+            size_t capacity,
+            size_t minCapacity,
+            size_t maxCapacity,
+            uint32_t windowLength
+        ) :
+            m_capacity( capacity ),
+            m_initialCapacity( capacity ),
+            m_minCapacity( std::min( minCapacity, capacity ) ),
+            m_maxCapacity( std::max( maxCapacity, capacity ) ),
+            m_window( std::max( windowLength, 1u ), 0u ),
+            m_nextSlot( 0u ),
+            m_numFilledSlots( 0u ),
+            m_demand( 0u )
+        {
+        }
+
+        /** account one transfer round of the current exchange
+         *
+         * @param numParticles number of particles transferred in the round
+         */
+        void addRound( size_t numParticles )
+        {
+            m_demand += numParticles;
+        }
+
+        /** finish the current exchange
+         *
+         * @return capacity for the next exchange
+         */
+        size_t finishExchange( )
+        {
+            m_window[ m_nextSlot ] = m_demand;
+            m_nextSlot = ( m_nextSlot + 1u ) % m_window.size( );
+            m_numFilledSlots = std::min( m_numFilledSlots + 1u, m_window.size( ) );
+            m_demand = 0u;
+
+            size_t const highWater = *std::max_element( m_window.begin( ), m_window.end( ) );
+            // keep 25% headroom, a stack filled completely always needs an extra round
+            size_t const target = std::min(
+                std::max( highWater + highWater / 4u + 1u, m_minCapacity ),
+                m_maxCapacity
+            );
+
+            bool const isOverflow = highWater >= m_capacity;
+            bool const isIdle = m_numFilledSlots == m_window.size( ) && target <= m_capacity / 2u;
+            if( isOverflow || isIdle )
+                m_capacity = target;
+
+            return m_capacity;
+        }
+
+        /** restore the initial capacity and forget all previous exchanges
+         *
+         * Both sides of a direction must reset together, e.g. if the
+         * neighbor of a direction changes.
+         */
+        void reset( )
+        {
+            m_capacity = m_initialCapacity;
+            std::fill( m_window.begin( ), m_window.end( ), 0u );
+            m_nextSlot = 0u;
+            m_numFilledSlots = 0u;
+            m_demand = 0u;
+        }
+
+        /** continue with a given capacity and forget all previous exchanges
+         *
+         * Used to keep an adapted capacity when the neighbor of a direction
+         * changes: both sides of a direction must restart together with the
+         * same capacity.
+         *
+         * @param capacity number of particles the stack can hold, limited to
+         *                 the lower and upper limit of the policy
+         */
+        void restart( size_t capacity )
+        {
+            m_capacity = std::min( std::max( capacity, m_minCapacity ), m_maxCapacity );
+            std::fill( m_window.begin( ), m_window.end( ), 0u );
+            m_nextSlot = 0u;
+            m_numFilledSlots = 0u;
+            m_demand = 0u;
+        }
+
+        //! number of particles the stack can hold
+        size_t getCapacity( ) const
+        {
+            return m_capacity;
+        }
+
+        //! true if the capacity can not grow any further
+        bool isAtMaximum( ) const
+        {
+            return m_capacity == m_maxCapacity;
+        }
+
+    private:
+
+        size_t m_capacity;
+        size_t m_initialCapacity;
+        size_t m_minCapacity;
+        size_t m_maxCapacity;
+        //! number of particles transferred during the last exchanges
+        std::vector< size_t > m_window;
+        size_t m_nextSlot;
+        size_t m_numFilledSlots;
+        //! number of particles transferred during the current exchange
+        size_t m_demand;
+    };
+
+} // namespace pmacc
@@ -27,6 +27,7 @@
 #include "pmacc/dimensions/GridLayout.hpp"
 #include "pmacc/memory/dataTypes/Mask.hpp"
 #include "pmacc/particles/memory/buffers/StackExchangeBuffer.hpp"
+#include "pmacc/particles/memory/buffers/AdaptiveExchangeSize.hpp"
 #include "pmacc/eventSystem/EventSystem.hpp"
 #include "pmacc/particles/memory/dataTypes/SuperCell.hpp"
 
@@ -219,6 +220,23 @@ public:
      * @param usedMemory memory to be used for this exchange
      */
     void addExchange(Mask receive, size_t usedMemory, uint32_t communicationTag)
+    {
+        addExchange(receive, usedMemory, communicationTag, usedMemory, usedMemory, 1u);
+    }
+
+    /**
+     * Adds an exchange buffer to frames which adapts its size between exchanges.
+     *
+     * @see AdaptiveExchangeSize
+     *
+     * @param receive Mask describing receive directions
+     * @param usedMemory initial memory to be used for this exchange
+     * @param minMemory lower limit of the memory used for this exchange
+     * @param maxMemory upper limit of the memory used for this exchange
+     * @param windowLength number of exchanges the high-water mark is taken over
+     */
+    void addExchange(Mask receive, size_t usedMemory, uint32_t communicationTag,
+                     size_t minMemory, size_t maxMemory, uint32_t windowLength)
     {
 
         size_t numFrameTypeBorders = usedMemory / SizeOfOneBorderElement;
@@ -226,6 +244,24 @@ public:
         framesExchanges->addExchangeBuffer(receive, DataSpace<DIM1 > (numFrameTypeBorders), communicationTag, true, false);
 
         exchangeMemoryIndexer->addExchangeBuffer(receive, DataSpace<DIM1 > (numFrameTypeBorders), communicationTag | (1u << (20 - 5)), true, false);
+
+        /* the send stack of a direction and the receive stack of the mirrored
+         * direction of the neighbor start with the same size and follow the same policy */
+        AdaptiveExchangeSize exchangeSize(
+            numFrameTypeBorders,
+            minMemory / SizeOfOneBorderElement,
+            maxMemory / SizeOfOneBorderElement,
+            windowLength
+        );
+        Mask send = receive.getMirroredMask();
+        for (uint32_t ex = 1; ex < 27; ++ex)
+        {
+            if (send.isSet(ex))
+            {
+                sendExchangeSizes[ex] = exchangeSize;
+                receiveExchangeSizes[Mask::getMirroredExchangeType(ex)] = exchangeSize;
+            }
+        }
     }
 
     /**
@@ -295,6 +331,112 @@ public:
             (framesExchanges->getReceiveExchange(ex), exchangeMemoryIndexer->getReceiveExchange(ex));
     }
 
+    /**
+     * Returns the capacity policy of the send stack in ex direction.
+     *
+     * @param ex exchange direction
+     */
+    AdaptiveExchangeSize& getSendExchangeSize(uint32_t ex)
+    {
+        return sendExchangeSizes[ex];
+    }
+
+    /**
+     * Returns the capacity policy of the receive stack from ex direction.
+     *
+     * @param ex exchange direction
+     */
+    AdaptiveExchangeSize& getReceiveExchangeSize(uint32_t ex)
+    {
+        return receiveExchangeSizes[ex];
+    }
+
+    /**
+     * Resizes the send stack in ex direction to the capacity of its policy.
+     *
+     * Must not be called while particles of this direction are sent.
+     *
+     * @param ex exchange direction
+     */
+    void adaptSendExchange(uint32_t ex)
+    {
+        size_t const numParticles = sendExchangeSizes[ex].getCapacity();
+        size_t const oldNumParticles = getSendExchangeStack(ex).getMaxParticlesCount();
+        if (numParticles != oldNumParticles)
+        {
+            log<ggLog::MEMORY >("resize send exchange stack of %1% in direction %2%: %3% -> %4% particles") %
+                FrameType::getName() % ex % oldNumParticles % numParticles;
+            framesExchanges->resizeSendExchangeBuffer(ex, DataSpace<DIM1 > (numParticles));
+            exchangeMemoryIndexer->resizeSendExchangeBuffer(ex, DataSpace<DIM1 > (numParticles));
+        }
+    }
+
+    /**
+     * Resizes the receive stack from ex direction to the capacity of its policy.
+     *
+     * Must not be called while particles of this direction are received.
+     *
+     * @param ex exchange direction
+     */
+    void adaptReceiveExchange(uint32_t ex)
+    {
+        size_t const numParticles = receiveExchangeSizes[ex].getCapacity();
+        size_t const oldNumParticles = getReceiveExchangeStack(ex).getMaxParticlesCount();
+        if (numParticles != oldNumParticles)
+        {
+            log<ggLog::MEMORY >("resize receive exchange stack of %1% from direction %2%: %3% -> %4% particles") %
+                FrameType::getName() % ex % oldNumParticles % numParticles;
+            framesExchanges->resizeReceiveExchangeBuffer(ex, DataSpace<DIM1 > (numParticles));
+            exchangeMemoryIndexer->resizeReceiveExchangeBuffer(ex, DataSpace<DIM1 > (numParticles));
+        }
+    }
+
+    /**
+     * Returns the capacity a direction needs on this rank.
+     *
+     * This is the larger capacity of the send stack in ex direction and the
+     * receive stack from the mirrored direction, which both carry particles
+     * moving in ex direction.
+     *
+     * @param ex exchange direction
+     */
+    size_t getExchangeCapacity(uint32_t ex) const
+    {
+        return std::max(
+            sendExchangeSizes[ex].getCapacity(),
+            receiveExchangeSizes[Mask::getMirroredExchangeType(ex)].getCapacity()
+        );
+    }
+
+    /**
+     * Restarts the capacity policies of all stacks with agreed capacities and resizes the stacks.
+     *
+     * Must be called by all ranks together with the same capacities if the
+     * neighbors change (e.g. after a slide of the moving window) because the
+     * send stack of a rank and the receive stack of its neighbor follow the
+     * same exchange history.
+     * Must not be called while particles are sent or received.
+     *
+     * @param capacities capacities[ex] for the send stack in ex direction and
+     *                   the receive stack from the mirrored direction,
+     *                   27 entries
+     */
+    void restartExchangeSizes(size_t const * capacities)
+    {
+        for (uint32_t ex = 1; ex < 27; ++ex)
+        {
+            sendExchangeSizes[ex].restart(capacities[ex]);
+            receiveExchangeSizes[Mask::getMirroredExchangeType(ex)].restart(capacities[ex]);
+        }
+        for (uint32_t ex = 1; ex < 27; ++ex)
+        {
+            if (hasSendExchange(ex))
+                adaptSendExchange(ex);
+            if (hasReceiveExchange(ex))
+                adaptReceiveExchange(ex);
+        }
+    }
+
     /**
      * Starts sync data from own device buffer to neighbor device buffer.
      *
@@ -374,6 +516,10 @@ private:
     /*GridBuffer for hold borderFrames, we need a own buffer to create first exchanges without core memory*/
     GridBuffer< FrameType, DIM1, FrameTypeBorder> *framesExchanges;
 
+    //! capacity policy of the send and receive stacks, indexed by exchange direction
+    AdaptiveExchangeSize sendExchangeSizes[27];
+    AdaptiveExchangeSize receiveExchangeSizes[27];
+
     DataSpace<DIM> superCellSize;
     DataSpace<DIM> gridSize;
     std::shared_ptr<DeviceHeap> m_deviceHeap;
@@ -27,6 +27,8 @@
 
 #include "pmacc/mappings/threads/WorkerCfg.hpp"
 
+#include <limits>
+
 namespace pmacc
 {
 namespace particles
@@ -55,7 +57,9 @@ struct ConcatListOfFrames
 
     /** concatenate list of frames to single frame
      *
-     * @param counter[in,out] scalar offset in `destFrame`
+     * @param counter[in,out] scalar offset in `destFrame`, is increased by the
+     *                       number of selected particles even if they do not fit
+     *                       into `destFrame`
      * @param destFrame single frame were all particles are copied in
      * @param srcBox particle box were particles are read from
      * @param particleFilter filter to select particles
@@ -68,6 +72,7 @@ struct ConcatListOfFrames
      * @param mapper mapper which describes the area where particles are copied from
      * @param parFilter particle filter method, must fulfill the interface of pmacc::filter::Interface
      *                  The working domain for the filter is supercells.
+     * @param capacity number of particles which fit into `destFrame`
      */
     template<class T_DestFrame, class T_SrcBox, class T_Filter, class T_Space, class T_Identifier, class T_Mapping, typename T_ParticleFilter>
     void operator()(
@@ -78,7 +83,8 @@ struct ConcatListOfFrames
         const T_Space domainOffset,
         const T_Identifier domainCellIdxIdentifier,
         const T_Mapping mapper,
-        T_ParticleFilter & parFilter
+        T_ParticleFilter & parFilter,
+        const int capacity = std::numeric_limits<int>::max()
     )
     {
         #pragma omp parallel for
@@ -146,7 +152,7 @@ struct ConcatListOfFrames
 
                 for (int particleIdx = 0; particleIdx < particlesPerFrame; ++particleIdx)
                 {
-                    if (localIdxs[particleIdx] != -1)
+                    if (localIdxs[particleIdx] != -1 && globalOffset + localIdxs[particleIdx] < capacity)
                     {
                         auto parSrc = (srcFramePtr[particleIdx]);
                         auto parDest = destFrame[globalOffset + localIdxs[particleIdx]];
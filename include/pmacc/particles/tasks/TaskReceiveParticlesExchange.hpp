@@ -84,11 +84,15 @@ namespace pmacc
                     {
                         state=Wait;
                         PMACC_ASSERT(lastSize <= maxSize);
+                        parBase.getParticlesBuffer().getReceiveExchangeSize(exchange).addRound(lastSize);
                         //check for next bash round
                         if (lastSize == maxSize)
                             init(); //call init and run a full send cycle
                         else
                         {
+                            // all received particles are inserted, the stack is unused until the next exchange
+                            parBase.getParticlesBuffer().getReceiveExchangeSize(exchange).finishExchange();
+                            parBase.getParticlesBuffer().adaptReceiveExchange(exchange);
                             state = Finished;
                             return true;
                         }
@@ -83,6 +83,7 @@ namespace pmacc
                     if (nullptr == Environment<>::get().Manager().getITaskIfNotFinished(tmpEvent.getTaskId()))
                     {
                         PMACC_ASSERT(lastSize <= maxSize);
+                        parBase.getParticlesBuffer().getSendExchangeSize(exchange).addRound(lastSize);
                         //check for next bash round
                         if (lastSize == maxSize)
                         {
@@ -97,10 +98,18 @@ namespace pmacc
                 case WaitForSendEnd:
                     if (nullptr == Environment<>::get().Manager().getITaskIfNotFinished(lastSendEvent.getTaskId()))
                     {
+                        /* resizing creates tasks and can execute this task recursively */
+                        state = Resize;
+                        /* the stack is unused until the next exchange, the receiving neighbor
+                         * derives the same size from the same sequence of rounds */
+                        parBase.getParticlesBuffer().getSendExchangeSize(exchange).finishExchange();
+                        parBase.getParticlesBuffer().adaptSendExchange(exchange);
                         state = Finished;
                         return true;
                     }
                     break;
+                case Resize:
+                    break;
                 case Finished:
                     return true;
                 default:
@@ -113,7 +122,8 @@ namespace pmacc
         virtual ~TaskSendParticlesExchange()
         {
             notify(this->myId, RECVFINISHED, nullptr);
-            if(retryCounter != 0)
+            /* an adaptive stack is enlarged after an overflow, warn only if it can not grow anymore */
+            if(retryCounter != 0 && parBase.getParticlesBuffer().getSendExchangeSize(exchange).isAtMaximum())
             {
                 std::cerr << "Send/receive buffer for species " <<
                     ParBase::FrameType::getName() <<
@@ -141,6 +151,7 @@ namespace pmacc
             InitSend,
             WaitForSend,
             WaitForSendEnd,
+            Resize,
             Finished
 
         };
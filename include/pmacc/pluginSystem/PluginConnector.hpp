@@ -146,6 +146,32 @@ namespace pmacc
                 throw PluginException("Notifications for a nullptr object are not allowed.");
         }
 
+        /** Register an object that is notified after the plugins of a step
+         *
+         * Collectors are notified in each step in which at least one object of
+         * the notification list was notified, e.g. to execute work which was
+         * batched by the plugins of this step.
+         * Collectors are notified in the order they are registered.
+         *
+         * @param collector the object to notify
+         */
+        void registerNotificationCollector(INotify* collector)
+        {
+            if (collector != nullptr)
+                collectors.push_back(collector);
+            else
+                throw PluginException("Registering nullptr as a notification collector is not allowed.");
+        }
+
+        /** Remove a registered notification collector
+         *
+         * @param collector the object to remove
+         */
+        void unregisterNotificationCollector(INotify* collector)
+        {
+            collectors.remove(collector);
+        }
+
         /**
          * Notifies plugins that data should be dumped.
          *
@@ -153,6 +179,7 @@ namespace pmacc
          */
         void notifyPlugins(uint32_t currentStep)
         {
+            bool isAnyNotified = false;
             for (NotificationList::iterator iter = notificationList.begin();
                     iter != notificationList.end(); ++iter)
             {
@@ -166,8 +193,19 @@ namespace pmacc
                     INotify* notifiedObj = iter->first;
                     notifiedObj->notify(currentStep);
                     notifiedObj->setLastNotify(currentStep);
+                    isAnyNotified = true;
                 }
             }
+
+            if (!isAnyNotified)
+                return;
+
+            for (std::list<INotify*>::iterator iter = collectors.begin();
+                    iter != collectors.end(); ++iter)
+            {
+                (*iter)->notify(currentStep);
+                (*iter)->setLastNotify(currentStep);
+            }
         }
 
         /**
@@ -253,5 +291,7 @@ namespace pmacc
 
         std::list<IPlugin*> plugins;
         NotificationList notificationList;
+        //! objects notified after all plugins of a step
+        std::list<INotify*> collectors;
     };
 }
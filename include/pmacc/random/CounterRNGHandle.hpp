@@ -0,0 +1,132 @@
+/* Copyright 2018 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+#include "pmacc/random/Random.hpp"
+#include "pmacc/dimensions/DataSpace.hpp"
+
+namespace pmacc
+{
+namespace random
+{
+
+    /**
+     * Handle of a counter based RNG provider
+     *
+     * The handle owns its state. The state is derived from the key of the
+     * provider and the global cell index passed to init() and is never
+     * written back.
+     */
+    template<class T_RNGProvider>
+    struct CounterRNGHandle
+    {
+        typedef T_RNGProvider RNGProvider;
+        static constexpr uint32_t rngDim = RNGProvider::dim;
+        typedef typename RNGProvider::RNGMethod RNGMethod;
+        typedef typename RNGMethod::StateType RNGState;
+        typedef pmacc::DataSpace<rngDim> RNGSpace;
+
+        template<class T_Distribution>
+        struct GetRandomType
+        {
+            typedef typename T_Distribution::template applyMethod<RNGMethod>::type Distribution;
+            typedef Random<Distribution, RNGMethod, CounterRNGHandle> type;
+        };
+
+        /**
+         * Creates an instance of the functor
+         *
+         * @param seed seed of the provider, equal on all ranks
+         * @param step time step the handle is used in
+         * @param stream id of the handle within the time step
+         * @param localDomainOffset offset of the local domain within the global domain
+         * @param globalDomainSize size of the global domain
+         */
+        HDINLINE CounterRNGHandle(
+            uint32_t seed,
+            uint32_t step,
+            uint32_t stream,
+            const RNGSpace& localDomainOffset,
+            const RNGSpace& globalDomainSize
+        ) :
+            m_seed(seed), m_step(step), m_stream(stream),
+            m_localDomainOffset(localDomainOffset),
+            m_globalDomainSize(globalDomainSize)
+        {
+            init(RNGSpace::create(0));
+        }
+
+        /**
+         * Initializes this instance
+         *
+         * Handles initialized with the same cell index create the same sequence.
+         *
+         * \param cellIdx local cell index (without guards)
+         */
+        HDINLINE void
+        init(const RNGSpace& cellIdx)
+        {
+            const RNGSpace globalCellIdx = m_localDomainOffset + cellIdx;
+            uint64_t linearCellIdx = 0u;
+            for(int d = rngDim - 1; d >= 0; --d)
+                linearCellIdx = linearCellIdx * m_globalDomainSize[d] + globalCellIdx[d];
+
+            RNGMethod().init(m_state, m_seed, m_step, m_stream, linearCellIdx);
+        }
+
+        HDINLINE RNGState&
+        getState()
+        {
+            return m_state;
+        }
+
+        HDINLINE RNGState&
+        operator*()
+        {
+            return m_state;
+        }
+
+        HDINLINE RNGState&
+        operator->()
+        {
+            return m_state;
+        }
+
+        template<class T_Distribution>
+        HDINLINE typename GetRandomType<T_Distribution>::type
+        applyDistribution()
+        {
+            return typename GetRandomType<T_Distribution>::type(*this);
+        }
+
+    protected:
+        PMACC_ALIGN(m_seed, uint32_t);
+        PMACC_ALIGN(m_step, uint32_t);
+        PMACC_ALIGN(m_stream, uint32_t);
+        PMACC_ALIGN(m_localDomainOffset, RNGSpace);
+        PMACC_ALIGN(m_globalDomainSize, RNGSpace);
+        PMACC_ALIGN8(m_state, RNGState);
+    };
+
+}  // namespace random
+}  // namespace pmacc
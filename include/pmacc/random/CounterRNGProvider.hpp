@@ -0,0 +1,185 @@
+/* Copyright 2018 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+#include "pmacc/random/RNGProvider.hpp"
+#include "pmacc/random/CounterRNGHandle.hpp"
+#include "pmacc/random/methods/Philox4x32.hpp"
+#include "pmacc/dataManagement/ISimulationData.hpp"
+#include "pmacc/Environment.hpp"
+
+#include <stdexcept>
+#include <string>
+
+
+namespace pmacc
+{
+namespace random
+{
+
+    /**
+     * Provider of a counter based per cell random number generator
+     *
+     * No state is stored. Each handle is keyed with the seed, the current
+     * time step and a stream id counting the handles created within the time
+     * step. The sequence of a cell is selected by its global cell index.
+     * Random numbers are therefore independent of the domain decomposition
+     * and reproducible after a restart.
+     *
+     * Handles must be created in the same order on all ranks.
+     *
+     * \tparam T_dim Number of dimensions of the grid
+     * \tparam T_Acc accelerator type of the RNG method
+     */
+    template<uint32_t T_dim, typename T_Acc>
+    class RNGProvider<T_dim, methods::Philox4x32<T_Acc> > : public ISimulationData
+    {
+    public:
+        static constexpr uint32_t dim = T_dim;
+        typedef methods::Philox4x32<T_Acc> RNGMethod;
+        typedef DataSpace<dim> Space;
+        typedef CounterRNGHandle<RNGProvider> Handle;
+
+        //! false, the seed must be equal on all ranks
+        static constexpr bool hasState = false;
+
+        template<class T_Distribution>
+        struct GetRandomType
+        {
+            typedef typename T_Distribution::template applyMethod<RNGMethod>::type Distribution;
+            typedef Random<Distribution, RNGMethod, Handle> type;
+        };
+
+        /**
+         * Create the RNGProvider, no memory is allocated
+         *
+         * @param size Size of the local grid for which RNGs should be provided
+         * @param uniqueId Unique ID for this instance. If none is given the default
+         *          (as returned by \ref getName()) is used
+         */
+        RNGProvider(const Space& size, const std::string& uniqueId = ""):
+            m_size(size), m_uniqueId(uniqueId.empty() ? getName() : uniqueId),
+            m_seed(0), m_step(0), m_numStreams(0)
+        {
+            if(m_size.productOfComponents() == 0)
+                throw std::invalid_argument("Cannot create RNGProvider with zero size");
+        }
+
+        virtual ~RNGProvider()
+        {
+        }
+
+        /**
+         * Initializes the random number generators
+         * Must be called before usage
+         * @param seed Base seed to be used, must be equal on all ranks
+         */
+        void init(uint32_t seed)
+        {
+            m_seed = seed;
+        }
+
+        /**
+         * Factory method
+         * Creates a handle with a new stream id
+         *
+         * @param id SimulationDataId of the RNGProvider to use. Defaults to the default Id of the type
+         */
+        static Handle
+        createHandle(const std::string& id = getName())
+        {
+            auto provider =
+                Environment<>::get().DataConnector().get< RNGProvider >( id, true );
+            Handle result( provider->nextHandle() );
+            Environment<>::get().DataConnector().releaseData( id );
+            return result;
+        }
+
+        /**
+         * Factory method
+         * Creates functor that creates random numbers with a given distribution
+         * Similar to the Handle but can be used directly
+         *
+         * @param id SimulationDataId of the RNGProvider to use. Defaults to the default Id of the type
+         */
+        template<class T_Distribution>
+        static typename GetRandomType<T_Distribution>::type
+        createRandom(const std::string& id = getName())
+        {
+            typedef typename GetRandomType<T_Distribution>::type ResultType;
+            return ResultType(createHandle(id));
+        }
+
+        /**
+         * Returns the default id for this type
+         */
+        static std::string getName()
+        {
+            /* generate a unique name (for this type!) to use as a default ID */
+            return std::string("RNGProvider")
+                    + char('0' + dim) /* valid for 0..9 */
+                    + RNGMethod::getName();
+        }
+
+        SimulationDataId getUniqueId()
+        {
+            return m_uniqueId;
+        }
+
+        //! nothing to synchronize, the provider has no state
+        void synchronize()
+        {
+        }
+
+    private:
+
+        Handle nextHandle()
+        {
+            const uint32_t currentStep = Environment<>::get().SimulationDescription().getCurrentStep();
+            if(currentStep != m_step)
+            {
+                m_step = currentStep;
+                m_numStreams = 0;
+            }
+
+            const SubGrid<dim>& subGrid = Environment<dim>::get().SubGrid();
+            return Handle(
+                m_seed,
+                m_step,
+                m_numStreams++,
+                subGrid.getLocalDomain().offset,
+                subGrid.getGlobalDomain().size
+            );
+        }
+
+        const Space m_size;
+        const std::string m_uniqueId;
+        uint32_t m_seed;
+        //! time step of the last created handle
+        uint32_t m_step;
+        //! number of handles created during m_step
+        uint32_t m_numStreams;
+    };
+
+}  // namespace random
+}  // namespace pmacc
@@ -54,6 +54,9 @@ namespace random
         typedef typename Buffer::DataBoxType DataBoxType;
         typedef RNGHandle<RNGProvider> Handle;
 
+        //! true, a state per cell is stored and the seed should differ between ranks
+        static constexpr bool hasState = true;
+
         template<class T_Distribution>
         struct GetRandomType
         {
@@ -127,3 +130,4 @@ namespace random
 }  // namespace pmacc
 
 #include "pmacc/random/RNGProvider.tpp"
+#include "pmacc/random/CounterRNGProvider.hpp"
@@ -50,7 +50,7 @@ namespace random
 
         /** This can be constructed with either the RNGBox (like the RNGHandle) or from an RNGHandle instance */
         template<class T_RNGBoxOrHandle>
-        explicit HINLINE Random(const T_RNGBoxOrHandle& rngBox): RNGHandle(rngBox)
+        explicit HDINLINE Random(const T_RNGBoxOrHandle& rngBox): RNGHandle(rngBox)
         {}
 
         /**
@@ -26,6 +26,7 @@
 #include "pmacc/random/distributions/misc/MullerBox.hpp"
 #include "pmacc/random/methods/XorMin.hpp"
 #include "pmacc/random/methods/MRG32k3aMin.hpp"
+#include "pmacc/random/methods/Philox4x32.hpp"
 #include "pmacc/random/distributions/Uniform.hpp"
 #include "pmacc/algorithms/math.hpp"
 
@@ -78,6 +79,23 @@ namespace detail
 
     };
 #endif
+
+    //! specialization for Philox4x32, the state is not compatible with the alpaka RNG
+    template<
+        typename T_Acc
+    >
+    struct Normal<
+        float,
+        methods::Philox4x32< T_Acc >,
+        void
+    > :
+        public MullerBox<
+            float,
+            methods::Philox4x32< T_Acc >
+        >
+    {
+
+    };
 }  // namespace detail
 }  // namespace distributions
 }  // namespace random
@@ -0,0 +1,206 @@
+/* Copyright 2018 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+
+#include <string>
+
+
+namespace pmacc
+{
+namespace random
+{
+namespace methods
+{
+
+    /** counter based random number generator Philox4x32-10
+     *
+     * Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC'11
+     *
+     * Each block of four random numbers is a bijection of a 128bit counter
+     * with a 64bit key. The state holds no history, it is fully described by
+     * the key and the counter and can be created on the fly for any
+     * (seed, step, stream, cell) tuple.
+     *
+     * The key is (seed, step), the counter is (draw, stream, sequence).
+     * The 64bit sequence is the global linear cell index if the method is
+     * used with the RNGProvider.
+     */
+    template< typename T_Acc = cupla::Acc >
+    class Philox4x32
+    {
+    public:
+        class StateType
+        {
+        public:
+            PMACC_ALIGN(
+                key[ 2 ],
+                uint32_t
+            );
+            PMACC_ALIGN(
+                counter[ 4 ],
+                uint32_t
+            );
+            //! cached random numbers of the last generated block
+            PMACC_ALIGN(
+                result[ 4 ],
+                uint32_t
+            );
+            //! index of the next unused number in result, 4 if the cache is empty
+            PMACC_ALIGN(
+                resultIdx,
+                uint32_t
+            );
+        };
+
+        DINLINE void
+        init(
+            T_Acc const & acc,
+            StateType & state,
+            uint32_t seed,
+            uint32_t subsequence = 0
+        ) const
+        {
+            init(
+                state,
+                seed,
+                0u,
+                0u,
+                subsequence
+            );
+        }
+
+        /** initialize a state
+         *
+         * @param state state to initialize
+         * @param seed seed, equal on all ranks
+         * @param step simulation time step
+         * @param stream id to distinguish independent users within a time step
+         * @param sequence id of the sequence, e.g. the global linear cell index
+         */
+        HDINLINE void
+        init(
+            StateType & state,
+            uint32_t seed,
+            uint32_t step,
+            uint32_t stream,
+            uint64_t sequence
+        ) const
+        {
+            state.key[ 0 ] = seed;
+            state.key[ 1 ] = step;
+            state.counter[ 0 ] = 0u;
+            state.counter[ 1 ] = stream;
+            state.counter[ 2 ] = static_cast< uint32_t >( sequence );
+            state.counter[ 3 ] = static_cast< uint32_t >( sequence >> 32 );
+            state.resultIdx = 4u;
+        }
+
+        DINLINE uint32_t
+        get32Bits(
+            T_Acc const & acc,
+            StateType & state
+        ) const
+        {
+            if( state.resultIdx == 4u )
+            {
+                generateBlock(
+                    state.counter,
+                    state.key,
+                    state.result
+                );
+                // the first counter word numbers the blocks of a sequence
+                ++state.counter[ 0 ];
+                state.resultIdx = 0u;
+            }
+            return state.result[ state.resultIdx++ ];
+        }
+
+        DINLINE uint64_t
+        get64Bits(
+            T_Acc const & acc,
+            StateType & state
+        ) const
+        {
+            // two 32bit values are packed into a 64bit value
+            uint64_t result = get32Bits( acc, state );
+            result <<= 32;
+            result ^= get32Bits( acc, state );
+            return result;
+        }
+
+        /** compute the random numbers of a counter
+         *
+         * @param counter 128bit counter
+         * @param key 64bit key
+         * @param[out] result four random numbers
+         */
+        HDINLINE static void
+        generateBlock(
+            uint32_t const counter[ 4 ],
+            uint32_t const key[ 2 ],
+            uint32_t result[ 4 ]
+        )
+        {
+            constexpr uint32_t multiplier0 = 0xD2511F53u;
+            constexpr uint32_t multiplier1 = 0xCD9E8D57u;
+            // Weyl sequence increments: golden ratio and sqrt(3) - 1
+            constexpr uint32_t keyIncrement0 = 0x9E3779B9u;
+            constexpr uint32_t keyIncrement1 = 0xBB67AE85u;
+            constexpr uint32_t numRounds = 10u;
+
+            uint32_t c[ 4 ] = { counter[ 0 ], counter[ 1 ], counter[ 2 ], counter[ 3 ] };
+            uint32_t k[ 2 ] = { key[ 0 ], key[ 1 ] };
+
+            for( uint32_t round = 0u; round < numRounds; ++round )
+            {
+                uint64_t const product0 = static_cast< uint64_t >( multiplier0 ) * c[ 0 ];
+                uint64_t const product1 = static_cast< uint64_t >( multiplier1 ) * c[ 2 ];
+
+                uint32_t const tmp[ 4 ] = {
+                    static_cast< uint32_t >( product1 >> 32 ) ^ c[ 1 ] ^ k[ 0 ],
+                    static_cast< uint32_t >( product1 ),
+                    static_cast< uint32_t >( product0 >> 32 ) ^ c[ 3 ] ^ k[ 1 ],
+                    static_cast< uint32_t >( product0 )
+                };
+                for( uint32_t i = 0u; i < 4u; ++i )
+                    c[ i ] = tmp[ i ];
+
+                k[ 0 ] += keyIncrement0;
+                k[ 1 ] += keyIncrement1;
+            }
+
+            for( uint32_t i = 0u; i < 4u; ++i )
+                result[ i ] = c[ i ];
+        }
+
+        static std::string
+        getName( )
+        {
+            return "Philox4x32";
+        }
+    };
+
+}  // namespace methods
+}  // namespace random
+}  // namespace pmacc
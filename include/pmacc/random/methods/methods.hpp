@@ -23,4 +23,5 @@
 
 #include "pmacc/random/methods/AlpakaRand.hpp"
 #include "pmacc/random/methods/MRG32k3aMin.hpp"
+#include "pmacc/random/methods/Philox4x32.hpp"
 #include "pmacc/random/methods/XorMin.hpp"
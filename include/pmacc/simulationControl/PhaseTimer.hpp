@@ -0,0 +1,155 @@
+/* Copyright 2018 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+#include "pmacc/Environment.hpp"
+
+#include <chrono>
+#include <map>
+#include <string>
+
+
+namespace pmacc
+{
+
+    /** wall clock time of the phases of a simulation step
+     *
+     * The times of all phases are accumulated until reset() is called.
+     * Timing is disabled by default. If enabled, all PMacc tasks are finished
+     * at the begin and at the end of each phase, therefore the overlap of
+     * computation and communication between phases is lost.
+     */
+    class PhaseTimer
+    {
+    public:
+
+        using Clock = std::chrono::steady_clock;
+
+        /** time a phase for the life time of the object
+         *
+         * Nested phases are allowed, the time of the inner phase is also
+         * contained in the outer phase.
+         */
+        class Scope
+        {
+        public:
+
+            /**
+             * @param phase name of the phase
+             */
+            Scope( std::string const & phase ) :
+                m_phase( phase ),
+                m_isEnabled( PhaseTimer::getInstance().isEnabled() )
+            {
+                if( m_isEnabled )
+                {
+                    Environment<>::get().Manager().waitForAllTasks();
+                    m_start = Clock::now();
+                }
+            }
+
+            Scope( Scope const & ) = delete;
+            Scope & operator=( Scope const & ) = delete;
+
+            ~Scope()
+            {
+                if( m_isEnabled )
+                {
+                    Environment<>::get().Manager().waitForAllTasks();
+                    std::chrono::duration< double, std::milli > const duration = Clock::now() - m_start;
+                    PhaseTimer::getInstance().add( m_phase, duration.count() );
+                }
+            }
+
+        private:
+            std::string const m_phase;
+            bool const m_isEnabled;
+            Clock::time_point m_start;
+        };
+
+        static PhaseTimer & getInstance()
+        {
+            static PhaseTimer instance;
+            return instance;
+        }
+
+        void setEnabled( bool const isEnabled )
+        {
+            m_isEnabled = isEnabled;
+        }
+
+        bool isEnabled() const
+        {
+            return m_isEnabled;
+        }
+
+        /** add time to a phase
+         *
+         * @param phase name of the phase
+         * @param milliseconds time in milliseconds
+         */
+        void add(
+            std::string const & phase,
+            double const milliseconds
+        )
+        {
+            m_times[ phase ] += milliseconds;
+        }
+
+        //! count a finished simulation step
+        void nextStep()
+        {
+            if( m_isEnabled )
+                ++m_numSteps;
+        }
+
+        //! accumulated time in milliseconds of each phase, sorted by name
+        std::map< std::string, double > const & getTimes() const
+        {
+            return m_times;
+        }
+
+        //! number of finished steps since the last reset
+        uint32_t getNumSteps() const
+        {
+            return m_numSteps;
+        }
+
+        //! clear all accumulated times
+        void reset()
+        {
+            for( auto & time : m_times )
+                time.second = 0.0;
+            m_numSteps = 0u;
+        }
+
+    private:
+
+        PhaseTimer() = default;
+
+        bool m_isEnabled = false;
+        uint32_t m_numSteps = 0u;
+        std::map< std::string, double > m_times;
+    };
+
+} // namespace pmacc
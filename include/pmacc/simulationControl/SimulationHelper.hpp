@@ -28,6 +28,8 @@
 #include "pmacc/mappings/simulation/GridController.hpp"
 #include "pmacc/dimensions/DataSpace.hpp"
 #include "TimeInterval.hpp"
+#include "pmacc/simulationControl/PhaseTimer.hpp"
+#include "pmacc/eventSystem/tasks/KernelProfiler.hpp"
 #include "pmacc/dataManagement/DataConnector.hpp"
 #include "pmacc/Environment.hpp"
 #include "pmacc/pluginSystem/IPlugin.hpp"
@@ -72,7 +74,9 @@ public:
     restartDirectory("checkpoints"),
     restartRequested(false),
     CHECKPOINT_MASTER_FILE("checkpoints.txt"),
-    author("")
+    author(""),
+    kernelProfilePrefix(""),
+    kernelProfileMaxTraceEvents(100000)
     {
         tSimulation.toggleStart();
         tInit.toggleStart();
@@ -138,7 +142,10 @@ public:
     virtual void dumpOneStep(uint32_t currentStep)
     {
         /* trigger notification */
-        Environment<DIM>::get().PluginConnector().notifyPlugins(currentStep);
+        {
+            PhaseTimer::Scope phase( "plugins" );
+            Environment<DIM>::get().PluginConnector().notifyPlugins(currentStep);
+        }
 
         /* trigger checkpoint notification */
         if(
@@ -272,9 +279,13 @@ public:
             while (currentStep < Environment<>::get().SimulationDescription().getRunSteps())
             {
                 tRound.toggleStart();
-                runOneStep(currentStep);
+                {
+                    PhaseTimer::Scope phase( "step" );
+                    runOneStep(currentStep);
+                }
                 tRound.toggleEnd();
                 roundAvg += tRound.getInterval();
+                PhaseTimer::getInstance().nextStep();
 
                 /* NEXT TIMESTEP STARTS HERE */
                 currentStep++;
@@ -282,7 +293,10 @@ public:
                 /* output times after a round */
                 dumpTimes(tSimCalculation, tRound, roundAvg, currentStep);
 
-                movingWindowCheck(currentStep);
+                {
+                    PhaseTimer::Scope phase( "movingWindow" );
+                    movingWindowCheck(currentStep);
+                }
                 /* dump at the beginning of the simulated step */
                 dumpOneStep(currentStep);
             }
@@ -292,6 +306,12 @@ public:
 
             tSimCalculation.toggleEnd();
 
+            Manager::Statistics const & schedulerStatistics = Environment<>::get().Manager().getStatistics();
+            log< ggLog::EVENT >( "Manager: %1% tasks polled, %2% tasks finished, %3% idle calls" ) %
+                schedulerStatistics.numPolled %
+                schedulerStatistics.numFinished %
+                schedulerStatistics.numIdleCalls;
+
             if (output)
             {
                 std::cout << "calculation  simulation time: " <<
@@ -319,7 +339,11 @@ public:
             ("checkpoint.directory", po::value<std::string>(&checkpointDirectory)->default_value(checkpointDirectory),
              "Directory for checkpoints")
             ("author", po::value<std::string>(&author)->default_value(std::string("")),
-             "The author that runs the simulation and is responsible for created output files");
+             "The author that runs the simulation and is responsible for created output files")
+            ("kernelProfile.prefix", po::value<std::string>(&kernelProfilePrefix)->default_value(kernelProfilePrefix),
+             "Enable the kernel profiler and write <prefix>_<rank>.txt (summary) and <prefix>_<rank>.json (Chrome trace)")
+            ("kernelProfile.maxTraceEvents", po::value<uint32_t>(&kernelProfileMaxTraceEvents)->default_value(kernelProfileMaxTraceEvents),
+             "Maximum number of kernel launches stored in the trace per rank");
     }
 
     std::string pluginGetName() const
@@ -335,10 +359,21 @@ public:
         calcProgress();
 
         output = (getGridController().getGlobalRank() == 0);
+
+        if (!kernelProfilePrefix.empty())
+            KernelProfiler::getInstance().enable(kernelProfileMaxTraceEvents);
     }
 
     void pluginUnload()
     {
+        if (KernelProfiler::getInstance().isEnabled())
+        {
+            Environment<>::get().Manager().waitForAllTasks();
+            KernelProfiler::getInstance().dump(
+                kernelProfilePrefix,
+                getGridController().getGlobalRank()
+            );
+        }
     }
 
     void restart(uint32_t, const std::string)
@@ -384,6 +419,12 @@ protected:
     /* author that runs the simulation */
     std::string author;
 
+    /* file name prefix of the kernel profile, empty if the profiler is disabled */
+    std::string kernelProfilePrefix;
+
+    /* maximum number of kernel launches in the trace */
+    uint32_t kernelProfileMaxTraceEvents;
+
 private:
 
     /**
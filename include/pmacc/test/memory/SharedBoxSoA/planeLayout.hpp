@@ -0,0 +1,92 @@
+/* Copyright 2018 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/* #includes in "test/memoryUT.cpp" */
+
+
+namespace pmacc
+{
+namespace test
+{
+namespace memory
+{
+namespace SharedBoxSoA
+{
+
+/**
+ * Checks that each vector component of a SharedBoxSoA is stored in its own
+ * contiguous plane and that the box behaves like a vector box.
+ */
+struct PlaneLayoutTest
+{
+    void exec()
+    {
+        using Size = ::pmacc::math::CT::Int< 4, 3, 2 >;
+        using Vec = ::pmacc::math::Vector< float, 3 >;
+        using SharedBox = ::pmacc::SharedBoxSoA< Vec, Size >;
+        using Box = ::pmacc::DataBox< SharedBox >;
+
+        constexpr int planeSize = 4 * 3 * 2;
+        std::vector< float > mem( 3 * planeSize, 0.0f );
+        Box box( SharedBox( reinterpret_cast< SharedBox::PlaneVector* >( mem.data() ) ) );
+
+        ::pmacc::DataSpace< DIM3 > const extent( 4, 3, 2 );
+        for( int i = 0; i < planeSize; ++i )
+        {
+            ::pmacc::DataSpace< DIM3 > const idx =
+                ::pmacc::DataSpaceOperations< DIM3 >::map( extent, i );
+            box( idx ) = Vec( float( i ), float( 100 + i ), float( 200 + i ) );
+        }
+
+        for( int i = 0; i < planeSize; ++i )
+            for( int d = 0; d < 3; ++d )
+                BOOST_CHECK_EQUAL( mem[ d * planeSize + i ], float( d * 100 + i ) );
+
+        // access via shifted boxes and operator[] must match the linear layout
+        auto shifted = box.shift( ::pmacc::DataSpace< DIM3 >( 1, 1, 1 ) );
+        int const linearIdx = 1 + 1 * 4 + 1 * 4 * 3;
+        BOOST_CHECK_EQUAL( shifted( ::pmacc::DataSpace< DIM3 >() ).y(), float( 100 + linearIdx ) );
+        BOOST_CHECK_EQUAL( box[ 1 ][ 1 ][ 1 ].z(), float( 200 + linearIdx ) );
+
+        // arithmetic returns plain vectors
+        Vec const diff = box( ::pmacc::DataSpace< DIM3 >( 1, 0, 0 ) ) -
+            box( ::pmacc::DataSpace< DIM3 >() );
+        BOOST_CHECK_EQUAL( diff.x(), 1.0f );
+        BOOST_CHECK_EQUAL( diff.y(), 1.0f );
+        BOOST_CHECK_EQUAL( diff.z(), 1.0f );
+
+        shifted( ::pmacc::DataSpace< DIM3 >() ) += diff;
+        BOOST_CHECK_EQUAL( mem[ linearIdx ], float( linearIdx + 1 ) );
+        BOOST_CHECK_EQUAL( mem[ 2 * planeSize + linearIdx ], float( 200 + linearIdx + 1 ) );
+    }
+};
+
+} // namespace SharedBoxSoA
+} // namespace memory
+} // namespace test
+} // namespace pmacc
+
+BOOST_AUTO_TEST_CASE( planeLayout )
+{
+    pmacc::test::memory::SharedBoxSoA::PlaneLayoutTest().exec();
+}
@@ -43,6 +43,9 @@
 #include <pmacc/memory/buffers/DeviceBufferIntern.hpp>
 #include <pmacc/memory/buffers/DeviceBuffer.hpp>
 #include <pmacc/dimensions/DataSpace.hpp>
+#include <pmacc/dimensions/DataSpaceOperations.hpp>
+#include <pmacc/memory/boxes/DataBox.hpp>
+#include <pmacc/memory/boxes/SharedBoxSoA.hpp>
 #include "pmacc/types.hpp" /* DIM1,DIM2,DIM3 */
 
 
@@ -110,4 +113,8 @@ BOOST_AUTO_TEST_SUITE( memory )
 #   include "HostBufferIntern/setValue.hpp"
   BOOST_AUTO_TEST_SUITE_END()
 
+  BOOST_AUTO_TEST_SUITE( SharedBoxSoA )
+#   include "SharedBoxSoA/planeLayout.hpp"
+  BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+/* Copyright 2018 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <pmacc/particles/memory/buffers/AdaptiveExchangeSize.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <stdint.h>
+
+BOOST_AUTO_TEST_SUITE( particles )
+
+
+namespace pmacc
+{
+namespace test
+{
+namespace particles
+{
+
+    struct AdaptiveExchangeSizeTest
+    {
+        /** run one exchange the way the send/receive tasks do
+         *
+         * @return number of transfer rounds
+         */
+        static uint32_t exchange( ::pmacc::AdaptiveExchangeSize & exchangeSize, size_t numParticles )
+        {
+            size_t const capacity = exchangeSize.getCapacity( );
+            uint32_t numRounds = 0u;
+            size_t roundSize = 0u;
+            do
+            {
+                roundSize = std::min( numParticles, capacity );
+                numParticles -= roundSize;
+                exchangeSize.addRound( roundSize );
+                ++numRounds;
+            }
+            while( roundSize == capacity );
+            exchangeSize.finishExchange( );
+            return numRounds;
+        }
+
+        void operator()()
+        {
+            using namespace ::pmacc;
+
+            constexpr uint32_t windowLength = 8u;
+
+            // a fixed policy never changes the capacity
+            AdaptiveExchangeSize fixed( 100u );
+            BOOST_REQUIRE_EQUAL( exchange( fixed, 250u ), 3u );
+            BOOST_REQUIRE_EQUAL( fixed.getCapacity( ), 100u );
+            BOOST_REQUIRE( fixed.isAtMaximum( ) );
+
+            AdaptiveExchangeSize adaptive( 100u, 10u, 1000u, windowLength );
+
+            // an overflow grows the stack, the next exchange needs one round
+            BOOST_REQUIRE_EQUAL( exchange( adaptive, 250u ), 3u );
+            BOOST_REQUIRE_GT( adaptive.getCapacity( ), 250u );
+            BOOST_REQUIRE_EQUAL( exchange( adaptive, 250u ), 1u );
+
+            // an exchange which fills the stack exactly needs an extra round
+            size_t const capacity = adaptive.getCapacity( );
+            BOOST_REQUIRE_EQUAL( exchange( adaptive, capacity ), 2u );
+            BOOST_REQUIRE_GT( adaptive.getCapacity( ), capacity );
+
+            // the stack keeps its size while the high-water mark is in the window
+            size_t const grownCapacity = adaptive.getCapacity( );
+            for( uint32_t i = 0u; i < windowLength - 1u; ++i )
+            {
+                BOOST_REQUIRE_EQUAL( exchange( adaptive, 20u ), 1u );
+                BOOST_REQUIRE_EQUAL( adaptive.getCapacity( ), grownCapacity );
+            }
+
+            // and shrinks afterwards but not below the lower limit
+            BOOST_REQUIRE_EQUAL( exchange( adaptive, 0u ), 1u );
+            BOOST_REQUIRE_LT( adaptive.getCapacity( ), grownCapacity );
+            BOOST_REQUIRE_GT( adaptive.getCapacity( ), 20u );
+            for( uint32_t i = 0u; i < windowLength; ++i )
+                exchange( adaptive, 0u );
+            BOOST_REQUIRE_EQUAL( adaptive.getCapacity( ), 10u );
+
+            // growing stops at the upper limit
+            exchange( adaptive, 5000u );
+            BOOST_REQUIRE_EQUAL( adaptive.getCapacity( ), 1000u );
+            BOOST_REQUIRE( adaptive.isAtMaximum( ) );
+
+            // a reset restores the initial capacity and forgets the high-water mark
+            adaptive.reset( );
+            BOOST_REQUIRE_EQUAL( adaptive.getCapacity( ), 100u );
+            BOOST_REQUIRE_EQUAL( exchange( adaptive, 20u ), 1u );
+            BOOST_REQUIRE_EQUAL( adaptive.getCapacity( ), 100u );
+
+            // a restart keeps an agreed capacity within the limits
+            adaptive.restart( 600u );
+            BOOST_REQUIRE_EQUAL( adaptive.getCapacity( ), 600u );
+            adaptive.restart( 5000u );
+            BOOST_REQUIRE( adaptive.isAtMaximum( ) );
+            adaptive.restart( 1u );
+            BOOST_REQUIRE_EQUAL( adaptive.getCapacity( ), 10u );
+
+            // the forgotten window does not shrink the stack before it is full again
+            adaptive.restart( 600u );
+            for( uint32_t i = 0u; i < windowLength - 1u; ++i )
+                exchange( adaptive, 0u );
+            BOOST_REQUIRE_EQUAL( adaptive.getCapacity( ), 600u );
+        }
+    };
+
+} // namespace particles
+} // namespace test
+} // namespace pmacc
+
+BOOST_AUTO_TEST_CASE( AdaptiveExchangeSize )
+{
+    using namespace pmacc::test::particles;
+    AdaptiveExchangeSizeTest()();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
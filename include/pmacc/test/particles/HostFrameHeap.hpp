@@ -0,0 +1,110 @@
+/* Copyright 2018 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <pmacc/particles/memory/HostFrameHeap.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <set>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+BOOST_AUTO_TEST_SUITE( particles )
+
+
+namespace pmacc
+{
+namespace test
+{
+namespace particles
+{
+
+    struct HostFrameHeapTest
+    {
+        void operator()()
+        {
+            using namespace ::pmacc;
+
+            constexpr size_t frameSize = 1000u;
+            constexpr uint32_t numFrames = 256u;
+            constexpr size_t blockSize = 1024u + HostFrameHeap::alignment;
+
+            HostFrameHeap heap( numFrames * blockSize );
+            HostFrameHeap::AllocatorHandle handle = heap.getAllocatorHandle();
+            BOOST_REQUIRE_EQUAL( heap.getAvailableSlots( frameSize ), numFrames );
+
+            // exhaust the heap, all frames must be aligned and disjoint
+            std::set< uint8_t* > frames;
+            for( uint32_t i = 0u; i < numFrames; ++i )
+            {
+                uint8_t* frame = static_cast< uint8_t* >( handle.malloc( frameSize ) );
+                BOOST_REQUIRE( frame != nullptr );
+                BOOST_REQUIRE_EQUAL( reinterpret_cast< size_t >( frame ) % HostFrameHeap::alignment, 0u );
+                BOOST_REQUIRE( frames.insert( frame ).second );
+            }
+            BOOST_REQUIRE( handle.malloc( frameSize ) == nullptr );
+            BOOST_REQUIRE_EQUAL( heap.getHighWaterSlots( frameSize ), numFrames );
+
+            // released frames are recycled without touching the reserved memory again
+            for( uint8_t* frame : frames )
+                handle.free( frame );
+            for( uint32_t i = 0u; i < numFrames; ++i )
+            {
+                uint8_t* frame = static_cast< uint8_t* >( handle.malloc( frameSize ) );
+                BOOST_REQUIRE( frames.count( frame ) == 1u );
+            }
+            BOOST_REQUIRE_EQUAL( heap.getHighWaterSlots( frameSize ), numFrames );
+
+            // frames released by one thread must be usable by another thread
+            heap.destructiveResize( numFrames * blockSize );
+            std::vector< void* > released( numFrames );
+            std::thread producer(
+                [&]( )
+                {
+                    for( uint32_t i = 0u; i < numFrames; ++i )
+                        released[ i ] = handle.malloc( frameSize );
+                    for( uint32_t i = 0u; i < numFrames; ++i )
+                        handle.free( released[ i ] );
+                }
+            );
+            producer.join( );
+            uint32_t numRecycled = 0u;
+            for( uint32_t i = 0u; i < numFrames; ++i )
+                if( handle.malloc( frameSize ) != nullptr )
+                    ++numRecycled;
+            // the producer thread keeps up to `2 * cacheBatchSize` frames in its private list
+            BOOST_REQUIRE_GE( numRecycled, numFrames - 2u * HostFrameHeap::cacheBatchSize );
+        }
+    };
+
+} // namespace particles
+} // namespace test
+} // namespace pmacc
+
+BOOST_AUTO_TEST_CASE( HostFrameHeap )
+{
+    using namespace pmacc::test::particles;
+    HostFrameHeapTest()();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -90,6 +90,48 @@ namespace particles
         }
     };
 
+    template<
+        uint32_t T_numWorkers,
+        uint32_t T_numIdsPerBlock,
+        typename T_IdProvider
+    >
+    struct ReserveIds
+    {
+        template<class T_Box, typename T_Acc>
+        HDINLINE void operator()(const T_Acc & acc, T_Box outputbox, uint32_t numThreads, uint32_t numIdsPerThread) const
+        {
+            using namespace ::pmacc;
+            using namespace mappings::threads;
+
+            constexpr uint32_t numWorkers = T_numWorkers;
+
+            uint32_t const workerIdx = threadIdx.x;
+
+            uint32_t const blockId = blockIdx.x * T_numIdsPerBlock;
+            ForEachIdx<
+                IdxConfig<
+                    T_numIdsPerBlock,
+                    numWorkers
+                >
+            >{ workerIdx }(
+                [&](
+                    uint32_t const linearId,
+                    uint32_t const
+                )
+                {
+                    uint32_t const localId = blockId + linearId;
+                    if( localId < numThreads )
+                    {
+                        // each thread hands out the ids of its range itself
+                        uint64_t const firstId = T_IdProvider::reserveIds( numIdsPerThread );
+                        for( uint32_t i = 0u; i < numIdsPerThread; i++ )
+                            outputbox( localId * numIdsPerThread + i ) = firstId + i;
+                    }
+                }
+            );
+        }
+    };
+
 /**
  * Boost.Test compatible function that checks if a value is in a collection
  * Use like: BOOST_REQUIRE(checkDuplicate(col, value, true|false));
@@ -178,6 +220,30 @@ struct IdProviderTest
         {
             BOOST_REQUIRE(checkDuplicate(ids, hostBox(i), true));
         }
+        // Reserving ranges hands out the same ids and advances the state alike
+        IdProvider::setState(state);
+        BOOST_REQUIRE_EQUAL(IdProvider::getNewIdHost(), state.nextId);
+        PMACC_KERNEL( ReserveIds<
+            numWorkers,
+            numIdsPerBlock,
+            IdProvider
+        >{  })(
+            numBlocks,
+            numWorkers
+        )(
+            idBuf.getDeviceBuffer().getDataBox(),
+            numThreads,
+            numIdsPerThread
+        );
+        idBuf.deviceToHost();
+        std::set<uint64_t> reservedIds;
+        for(uint32_t i=0; i<numIds; i++)
+        {
+            BOOST_REQUIRE(checkDuplicate(ids, hostBox(i), true));
+            reservedIds.insert(hostBox(i));
+        }
+        BOOST_REQUIRE_EQUAL(numIds, reservedIds.size());
+        BOOST_REQUIRE_EQUAL(IdProvider::getState().nextId, state.nextId + 1u + numIds);
     }
 };
 
@@ -33,3 +33,5 @@
 #endif
 
 #include "IdProvider.hpp"
+#include "HostFrameHeap.hpp"
+#include "AdaptiveExchangeSize.hpp"
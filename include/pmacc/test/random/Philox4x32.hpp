@@ -0,0 +1,119 @@
+/* Copyright 2018 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <pmacc/random/methods/Philox4x32.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <stdint.h>
+
+BOOST_AUTO_TEST_SUITE( rng )
+
+
+namespace pmacc
+{
+namespace test
+{
+namespace random
+{
+
+    struct Philox4x32Test
+    {
+        //! the accelerator is not used by the method
+        using Method = ::pmacc::random::methods::Philox4x32< int >;
+
+        static void checkBlock(
+            uint32_t const ( & counter )[ 4 ],
+            uint32_t const ( & key )[ 2 ],
+            uint32_t const ( & expected )[ 4 ]
+        )
+        {
+            uint32_t result[ 4 ];
+            Method::generateBlock( counter, key, result );
+            for( uint32_t i = 0u; i < 4u; ++i )
+                BOOST_REQUIRE_EQUAL( result[ i ], expected[ i ] );
+        }
+
+        void operator()()
+        {
+            // known answer tests of the Random123 reference implementation
+            checkBlock(
+                { 0u, 0u, 0u, 0u },
+                { 0u, 0u },
+                { 0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u }
+            );
+            checkBlock(
+                { 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu },
+                { 0xffffffffu, 0xffffffffu },
+                { 0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu }
+            );
+            checkBlock(
+                { 0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u },
+                { 0xa4093822u, 0x299f31d0u },
+                { 0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u }
+            );
+
+            Method const method;
+            int const acc = 0;
+
+            // a sequence consumes the blocks of consecutive counters
+            Method::StateType state;
+            method.init( state, 42u, 7u, 3u, 0x100000002ull );
+            uint32_t const key[ 2 ] = { 42u, 7u };
+            for( uint32_t draw = 0u; draw < 3u; ++draw )
+            {
+                uint32_t const counter[ 4 ] = { draw, 3u, 2u, 1u };
+                uint32_t expected[ 4 ];
+                Method::generateBlock( counter, key, expected );
+                for( uint32_t i = 0u; i < 4u; ++i )
+                    BOOST_REQUIRE_EQUAL( method.get32Bits( acc, state ), expected[ i ] );
+            }
+
+            // the same key and counter always create the same numbers
+            Method::StateType first;
+            Method::StateType second;
+            method.init( first, 1u, 2u, 3u, 4u );
+            method.init( second, 1u, 2u, 3u, 4u );
+            for( uint32_t i = 0u; i < 9u; ++i )
+                BOOST_REQUIRE_EQUAL( method.get64Bits( acc, first ), method.get64Bits( acc, second ) );
+
+            // neighboring streams and sequences are independent
+            method.init( first, 1u, 2u, 3u, 4u );
+            method.init( second, 1u, 2u, 4u, 4u );
+            BOOST_REQUIRE_NE( method.get64Bits( acc, first ), method.get64Bits( acc, second ) );
+            method.init( first, 1u, 2u, 3u, 4u );
+            method.init( second, 1u, 2u, 3u, 5u );
+            BOOST_REQUIRE_NE( method.get64Bits( acc, first ), method.get64Bits( acc, second ) );
+        }
+    };
+
+} // namespace random
+} // namespace test
+} // namespace pmacc
+
+BOOST_AUTO_TEST_CASE( Philox4x32 )
+{
+    using namespace pmacc::test::random;
+    Philox4x32Test()();
+}
+
+BOOST_AUTO_TEST_SUITE_END()